@@ -14,6 +14,7 @@
 
 
 #include <SDL3/SDL.h>
+#include <stddef.h> // offsetof
 #include <string.h>
 
 extern "C" {
@@ -251,14 +252,39 @@ struct CounterLinkedGoal;
 
 // A generic struct for a sub-item, like and advancement's criterion or a stat
 struct TrackableItem {
-    char root_name[192]; // The unique ID, e.g., "minecraft:husbandry/balanced_diet"
-    char display_name[192]; // The user-facing name, e.g., "A Balanced Diet"
-    char icon_path[256]; // Relative path to the icon, e.g., "items/apple.png"
+    // Hot state, read by every update, co-op merge, overlay row build and render pass. It stays packed
+    // into the first cache line so those passes don't stride through the names, paths and layout below.
+    bool done; // For advancements/unlocks: Is it completed?
+    bool is_manually_completed; // Allow manually overriding sub-stats (NOT FOR ACHIEVEMENTS/ADVANCEMENTS)
+    bool is_hidden; // If true, this item is hidden unless "Remove Completed Goals" is off
+    // Flag to allow "conflicting" criteria to overlay parent advancements icon (e.g., hoglin), init with false, cause of calloc
+    bool is_shared;
+    bool in_2nd_row; // Forces custom goals (or potentially stats) to the 2nd overlay row
+    bool in_3rd_row; // Forces unlocks to the 3rd overlay row (only meaningful for default Row 2 items)
+    bool is_visible_on_overlay; // Tracks if the item should be rendered
+    int progress; // For stats: The current value, e.g., 5.
+    int goal; // For stats: The target value, e.g., 40.
 
-    uint64_t icon_hash; // Cache for the image hash to prevent lag
+    // For legacy stat snapshotting
+    int initial_progress;
+
+    // Animation State
+    float alpha; // Current transparency (1.0f = opaque, 0.0f = transparent)
+
+    // Auto-completion via linked goals (used for sub-stats and manual custom goals)
+    int linked_goal_count;
+    LinkedGoalMode linked_goal_mode; // AND (all) or OR (any) for auto-completion
+    CounterLinkedGoal *linked_goals; // Dynamically allocated array of linked goals
 
     SDL_Texture *texture; // The loaded texture for the icon.
     AnimatedTexture *anim_texture; // To support .gif files
+    uint64_t icon_hash; // Cache for the image hash to prevent lag
+
+    // Cold data: identity, lookup keys and layout.
+    char root_name[192]; // The unique ID, e.g., "minecraft:husbandry/balanced_diet"
+    uint32_t root_sid; // root_name interned in TemplateData::string_pool (tracker process only)
+    char display_name[192]; // The user-facing name, e.g., "A Balanced Diet"
+    char icon_path[256]; // Relative path to the icon, e.g., "items/apple.png"
 
     // Pre-parsed keys for modern stat lookups
     char stat_category_key[192]; // e.g., "minecraft:custom"
@@ -269,29 +295,6 @@ struct TrackableItem {
     // one done means the whole group is done. Empty = ungrouped.
     char group[64];
 
-    bool done; // For advancements/unlocks: Is it completed?
-    int progress; // For stats: The current value, e.g., 5.
-    int goal; // For stats: The target value, e.g., 40.
-
-    // For legacy stat snapshotting
-    int initial_progress;
-
-    // Flag to allow "conflicting" criteria to overlay parent advancements icon (e.g., hoglin), init with false, cause of calloc
-    bool is_shared;
-    bool is_manually_completed; // Allow manually overriding sub-stats (NOT FOR ACHIEVEMENTS/ADVANCEMENTS)
-    bool is_hidden; // If true, this item is hidden unless "Remove Completed Goals" is off
-    bool in_2nd_row; // Forces custom goals (or potentially stats) to the 2nd overlay row
-    bool in_3rd_row; // Forces unlocks to the 3rd overlay row (only meaningful for default Row 2 items)
-
-    // Auto-completion via linked goals (used for sub-stats and manual custom goals)
-    int linked_goal_count;
-    CounterLinkedGoal *linked_goals; // Dynamically allocated array of linked goals
-    LinkedGoalMode linked_goal_mode; // AND (all) or OR (any) for auto-completion
-
-    // Animation State
-    float alpha; // Current transparency (1.0f = opaque, 0.0f = transparent)
-    bool is_visible_on_overlay; // Tracks if the item should be rendered
-
     // Manual Layout Positions
     ManualPos icon_pos;
     ManualPos text_pos;
@@ -322,27 +325,14 @@ struct TrackableItem {
     float cached_prog_font;
 };
 
+static_assert(offsetof(TrackableItem, icon_hash) + sizeof(uint64_t) <= 64,
+              "TrackableItem hot state must fit in the first cache line");
+
 
 // A struct to hold a category of trackable items (e.g., all Advancements).
 // This can be used for Advancements that have sub-criteria.
 struct TrackableCategory {
-    char root_name[192];
-    char display_name[192];
-    char icon_path[256];
-    SDL_Texture *texture; // Main icon texture for category/advancement
-    AnimatedTexture *anim_texture; // To support .gif files
-
-    // Recipe flag for modern version advancements
-    bool is_recipe;
-
-    // If stat category has no "criteria": {} it's single stat.
-    // If one criteria is defined it's still treated as a multi-stat in terms of rendering.
-    bool is_single_stat_category;
-
-    SDL_Texture *texture_bg;
-    SDL_Texture *texture_bg_half_done;
-    SDL_Texture *texture_bg_done;
-
+    // Hot state, kept in the first cache line like TrackableItem's.
     bool done;
     bool is_manually_completed; // For manually overriding stats (as they have criteria now with sub-stats)
     bool is_hidden; // If true, this category is hidden unless "Remove Completed Goals" is off.
@@ -353,10 +343,13 @@ struct TrackableCategory {
     bool hide_substats_in_row1;
     bool groups_enabled; // When false, criterion "group" fields are ignored (no collapse), even if present.
 
-    // Stat auto-completion via linked goals (only used for stat categories)
-    int linked_goal_count;
-    CounterLinkedGoal *linked_goals; // Dynamically allocated array of linked goals
-    LinkedGoalMode linked_goal_mode; // AND (all) or OR (any) for auto-completion
+    // Recipe flag for modern version advancements
+    bool is_recipe;
+
+    // If stat category has no "criteria": {} it's single stat.
+    // If one criteria is defined it's still treated as a multi-stat in terms of rendering.
+    bool is_single_stat_category;
+
     // To set an advancement/achievement to done when all the template criteria are met.
     // When game says advancement is done, then the advancement gets visually marked as done with the done background.
     // There could be a mistake in the template file, that an advancement has criteria that don't exist in the game,
@@ -364,6 +357,7 @@ struct TrackableCategory {
     // It will then continue displaying with the other incorrect criteria for debugging.
     bool all_template_criteria_met;
     bool done_in_snapshot; // For legacy stat snapshotting (for achievements)
+    bool is_visible_on_overlay; // Tracks if the category should be rendered
     int progress;
     int goal;
 
@@ -372,7 +366,27 @@ struct TrackableCategory {
     // Group-collapsed denominator: (distinct group IDs) + (ungrouped criteria).
     // Equals criteria_count when no criteria have a group ID set.
     int criteria_progress_total;
+
+    // Animation State
+    float alpha; // Current transparency (1.0f = opaque, 0.0f = transparent)
+
+    // Stat auto-completion via linked goals (only used for stat categories)
+    int linked_goal_count;
+    LinkedGoalMode linked_goal_mode; // AND (all) or OR (any) for auto-completion
     TrackableItem **criteria; // An array of sub-items
+    CounterLinkedGoal *linked_goals; // Dynamically allocated array of linked goals
+
+    // Cold data: identity, textures and layout.
+    char root_name[192];
+    uint32_t root_sid; // root_name interned in TemplateData::string_pool (tracker process only)
+    char display_name[192];
+    char icon_path[256];
+    SDL_Texture *texture; // Main icon texture for category/advancement
+    AnimatedTexture *anim_texture; // To support .gif files
+
+    SDL_Texture *texture_bg;
+    SDL_Texture *texture_bg_half_done;
+    SDL_Texture *texture_bg_done;
 
     // Coop: UUID of the player who first completed this goal in the merged "All Players" view.
     // Empty when not yet completed by any player. Cleared on goal reset / world change.
@@ -390,10 +404,6 @@ struct TrackableCategory {
     // it OR when more than one player did (multi-manual = no face).
     char manual_completer_uuid[48];
 
-    // Animation State
-    float alpha; // Current transparency (1.0f = opaque, 0.0f = transparent)
-    bool is_visible_on_overlay; // Tracks if the category should be rendered
-
     // Scroll state for long lists
     float scroll_y;
 
@@ -412,6 +422,9 @@ struct TrackableCategory {
     float cached_prog_font;
 };
 
+static_assert(offsetof(TrackableCategory, linked_goals) + sizeof(CounterLinkedGoal *) <= 64,
+              "TrackableCategory hot state must fit in the first cache line");
+
 
 // --------- MULTI-STAGE LONG-TERM GOALS ---------
 
@@ -499,6 +512,13 @@ struct CounterLinkedGoal {
     char stage_id[64]; // For multi-stage goal stages (empty = whole goal)
     char parent_root[192]; // Parent root_name for sub-items (criteria, sub-stats) (empty = top-level)
     LinkedGoalType type; // Which section to resolve root_name in (LINK_TYPE_ANY = legacy search order)
+
+    // Target resolved once per template load (tracker_load_and_parse_data), so evaluating the link
+    // doesn't search the template by name. Only meaningful in the tracker process that resolved it.
+    bool resolved; // false = not resolved yet, looked up by name instead
+    const bool *resolved_done; // The target's done flag (nullptr for multi-stage targets or no match)
+    const MultiStageGoal *resolved_msg; // Multi-stage target, completed by its current_stage
+    int resolved_stage; // Stage index in resolved_msg (-1 = the whole goal)
 };
 
 // Represents a counter goal that tracks how many of a set of goals are completed
@@ -611,6 +631,21 @@ struct TemplateData {
     int decoration_count; // Number of decoration elements (text headers, lines, arrows)
     DecorationElement **decorations;
 
+    // Linked-goal dependency graph compiled at load (tracker process only, nullptr in the overlay's copy)
+    struct LinkedGoalGraph *linked_goal_graph;
+    // Advancement/criterion name hashes for matching player files (tracker process only, nullptr in the overlay's copy)
+    struct AdvancementMatchIndex *advancement_match_index;
+    // Player file keys the template reads, to stream those files (tracker process only, nullptr in the overlay's copy)
+    struct PlayerFileKeySet *player_file_keys;
+    // Goal names and stage ids as 32-bit ids (tracker process only, nullptr in the overlay's copy)
+    struct StringPool *string_pool;
+    // Hermes stat keys mapped to the sub-stats and multi-stage stages they feed (tracker process only, nullptr in
+    // the overlay's copy)
+    struct HermesStatIndex *hermes_stat_index;
+    // Bump arena every goal, criterion, stage and decoration of this template is allocated from (tracker process
+    // only, nullptr in the overlay's copy). Reset as a whole when the template is freed.
+    struct TemplateArena *arena;
+
     // Overall Progress Metrics
     int total_criteria_count;
     int total_progress_steps; // To disable percentage progress text if nothing contributes to it
@@ -9,9 +9,14 @@
 
 #include "file_utils.h"
 #include "logger.h"
+#include "path_utils.h" // get_file_mtime_ms
+#include "profiler.h"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+#include <string>
+#include <unordered_map>
 
 #include <sys/stat.h> // stat/mkdir for fs_ensure_directory_exists
 
@@ -56,10 +61,8 @@ void fs_ensure_directory_exists(const char *path) {
     path_copy = nullptr;
 }
 
-// function to read a JSON file
-// In file_utils.cpp
-
-cJSON *cJSON_from_file(const char *filename) {
+// Reads a whole file into a null-terminated buffer, nullptr if it is missing, empty, huge or changed mid-read
+static char *read_file_to_buffer(const char *filename, size_t *out_length) {
     FILE *f = fopen(filename, "rb");
     if (!f) {
         // This is a common case when the game is saving, so we don't print an error.
@@ -73,7 +76,7 @@ cJSON *cJSON_from_file(const char *filename) {
 
     if (length <= 0) {
         fclose(f);
-        return cJSON_Parse(""); // Return null for empty files
+        return nullptr; // Empty files parse to null
     }
 
     // Sanity check to prevent allocating massive buffers due to file errors
@@ -102,10 +105,19 @@ cJSON *cJSON_from_file(const char *filename) {
     }
 
     buffer[length] = '\0';
+    *out_length = bytes_read;
+    return buffer;
+}
+
+// function to read a JSON file
+cJSON *cJSON_from_file(const char *filename) {
+    size_t length = 0;
+    char *buffer = read_file_to_buffer(filename, &length);
+    if (!buffer) return nullptr;
 
     // Directly parse the buffer without manual pre-processing.
     // Use ParseWithLength for maximum safety against malformed strings.
-    cJSON *json = cJSON_ParseWithLength(buffer, bytes_read);
+    cJSON *json = cJSON_ParseWithLength(buffer, length);
 
     if (json == nullptr) {
         const char *error_ptr = cJSON_GetErrorPtr();
@@ -120,6 +132,375 @@ cJSON *cJSON_from_file(const char *filename) {
     return json;
 }
 
+// STREAMING READER (cJSON_from_file_filtered)
+// Walks the text once. DESCENDed objects are rebuilt member by member, KEPT values are handed to cJSON's own
+// parser, and SKIPPED values are only scanned for their end, so they cost no allocations at all.
+
+#define JSON_STREAM_MAX_KEY 256 // Longer keys are never tracked; they are skipped unread
+#define JSON_STREAM_MAX_DEPTH 16
+
+static const char *json_stream_skip_ws(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    return p;
+}
+
+// p at the opening quote. Returns the position after the closing quote, nullptr if unterminated.
+static const char *json_stream_skip_string(const char *p, const char *end) {
+    for (p++; p < end; p++) {
+        if (*p == '\\') p++;
+        else if (*p == '"') return p + 1;
+    }
+    return nullptr;
+}
+
+// Scans past one value of any type. Returns nullptr on malformed input.
+static const char *json_stream_skip_value(const char *p, const char *end) {
+    if (p >= end) return nullptr;
+    if (*p == '"') return json_stream_skip_string(p, end);
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        while (p < end) {
+            if (*p == '"') {
+                p = json_stream_skip_string(p, end);
+                if (!p) return nullptr;
+                continue;
+            }
+            if (*p == '{' || *p == '[') depth++;
+            else if (*p == '}' || *p == ']') {
+                if (--depth == 0) return p + 1;
+            }
+            p++;
+        }
+        return nullptr;
+    }
+    // Number, true, false, null
+    const char *start = p;
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+        p++;
+    return p > start ? p : nullptr;
+}
+
+// Unescapes the key string at p into buf. Keys that are too long or non-ASCII set *untracked instead
+// (the key is still consumed).
+static const char *json_stream_read_key(const char *p, const char *end, char *buf, bool *untracked) {
+    if (p >= end || *p != '"') return nullptr;
+    size_t n = 0;
+    *untracked = false;
+    for (p++; p < end; p++) {
+        char c = *p;
+        if (c == '"') {
+            buf[n] = '\0';
+            return p + 1;
+        }
+        if (c == '\\') {
+            if (++p >= end) return nullptr;
+            switch (*p) {
+                case 'b': c = '\b';
+                    break;
+                case 'f': c = '\f';
+                    break;
+                case 'n': c = '\n';
+                    break;
+                case 'r': c = '\r';
+                    break;
+                case 't': c = '\t';
+                    break;
+                case 'u': {
+                    // Game keys are ASCII; anything else can never match a template key, so only flag it
+                    if (end - p < 5) return nullptr;
+                    unsigned code = 0;
+                    for (int i = 1; i <= 4; i++) {
+                        char h = p[i];
+                        code <<= 4;
+                        if (h >= '0' && h <= '9') code |= (unsigned) (h - '0');
+                        else if (h >= 'a' && h <= 'f') code |= (unsigned) (h - 'a' + 10);
+                        else if (h >= 'A' && h <= 'F') code |= (unsigned) (h - 'A' + 10);
+                        else return nullptr;
+                    }
+                    p += 4;
+                    if (code >= 0x80) *untracked = true;
+                    c = (char) code;
+                    break;
+                }
+                default: c = *p; // \" \\ \/
+                    break;
+            }
+        }
+        if (n + 1 < JSON_STREAM_MAX_KEY) buf[n++] = c;
+        else *untracked = true;
+    }
+    return nullptr;
+}
+
+// p at '{'. Adds the filtered members to out and returns the position after the closing brace.
+static const char *json_stream_object(const char *p, const char *end, int depth, const char *parent_key,
+                                      JsonKeyFilter filter, void *ctx, cJSON *out) {
+    if (depth >= JSON_STREAM_MAX_DEPTH || p >= end || *p != '{') return nullptr;
+    char key[JSON_STREAM_MAX_KEY];
+    p = json_stream_skip_ws(p + 1, end);
+    if (p < end && *p == '}') return p + 1;
+
+    while (p < end) {
+        bool untracked = false;
+        p = json_stream_read_key(p, end, key, &untracked);
+        if (!p) return nullptr;
+        p = json_stream_skip_ws(p, end);
+        if (p >= end || *p != ':') return nullptr;
+        p = json_stream_skip_ws(p + 1, end);
+
+        JsonFilterAction action = untracked ? JSON_FILTER_SKIP : filter(ctx, depth, parent_key, key);
+        if (action == JSON_FILTER_DESCEND && p < end && *p == '{') {
+            cJSON *child = cJSON_CreateObject();
+            if (!child) return nullptr;
+            cJSON_AddItemToObject(out, key, child);
+            p = json_stream_object(p, end, depth + 1, key, filter, ctx, child);
+        } else if (action != JSON_FILTER_SKIP) {
+            const char *value_end = nullptr;
+            cJSON *item = cJSON_ParseWithLengthOpts(p, (size_t) (end - p), &value_end, false);
+            if (!item) return nullptr;
+            cJSON_AddItemToObject(out, key, item);
+            p = value_end;
+        } else {
+            p = json_stream_skip_value(p, end);
+        }
+        if (!p) return nullptr;
+
+        p = json_stream_skip_ws(p, end);
+        if (p < end && *p == ',') {
+            p = json_stream_skip_ws(p + 1, end);
+            continue;
+        }
+        if (p < end && *p == '}') return p + 1;
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// Parses a file's bytes, streaming against the filter when there is one
+static cJSON *json_from_buffer_filtered(const char *buffer, size_t length, const char *filename,
+                                        JsonKeyFilter filter, void *ctx) {
+    if (!filter) {
+        cJSON *json = cJSON_ParseWithLength(buffer, length);
+        if (!json) log_message(LOG_ERROR, "[FILE UTILS] Malformed JSON in file: %s\n", filename);
+        return json;
+    }
+
+    const char *end = buffer + length;
+    const char *p = json_stream_skip_ws(buffer, end);
+    if (p + 3 <= end && (unsigned char) p[0] == 0xEF && (unsigned char) p[1] == 0xBB && (unsigned char) p[2] == 0xBF) {
+        p = json_stream_skip_ws(p + 3, end); // UTF-8 BOM
+    }
+
+    cJSON *json;
+    if (p < end && *p == '{') {
+        json = cJSON_CreateObject();
+        if (json && !json_stream_object(p, end, 0, nullptr, filter, ctx, json)) {
+            log_message(LOG_ERROR, "[FILE UTILS] Malformed JSON in file: %s\n", filename);
+            cJSON_Delete(json);
+            json = nullptr;
+        }
+    } else {
+        json = cJSON_ParseWithLength(buffer, length);
+    }
+    return json;
+}
+
+cJSON *cJSON_from_file_filtered(const char *filename, JsonKeyFilter filter, void *ctx) {
+    size_t length = 0;
+    char *buffer = read_file_to_buffer(filename, &length);
+    if (!buffer) return nullptr;
+
+    cJSON *json = json_from_buffer_filtered(buffer, length, filename, filter, ctx);
+    free(buffer);
+    return json;
+}
+
+// JSON FILE CACHE
+
+// POSIX mtimes here are whole seconds, so a file written in the same second as our read may have changed
+// again without its mtime moving. Such "racily clean" entries are re-hashed instead of trusted.
+#define JSON_FILE_CACHE_RACY_MS 2000
+// Co-op lobbies read a few files per player; more means stale paths (old worlds, departed players). Only the
+// least recently used files of earlier passes are evicted, so the cap is exceeded rather than freeing a tree
+// still in use.
+#define JSON_FILE_CACHE_MAX_FILES 64
+
+struct JsonFileCacheEntry {
+    uint64_t size;
+    uint64_t mtime_ms;
+    uint64_t hash; // FNV-1a of the file's bytes
+    uint64_t read_at_ms; // Wall clock of the last read, for the racy check
+    JsonKeyFilter filter; // How json was parsed
+    void *ctx;
+    cJSON *json;
+    uint64_t last_used; // JsonFileCache::use_count when it was last handed out or stored, for eviction
+    uint64_t pass; // JsonFileCache::pass it was last handed out or stored in
+};
+
+struct JsonFileCache {
+    std::unordered_map<std::string, JsonFileCacheEntry> entries;
+    uint64_t use_count;
+    uint64_t pass; // Advanced by json_file_cache_begin_pass
+};
+
+static void json_file_cache_touch(JsonFileCache *cache, JsonFileCacheEntry &entry) {
+    entry.last_used = ++cache->use_count;
+    entry.pass = cache->pass;
+}
+
+// Frees least recently used files from earlier passes until there is room for one more. Trees handed out in the
+// current pass are never freed; if they alone fill the cache, it grows past the cap instead.
+static void json_file_cache_evict(JsonFileCache *cache) {
+    while (cache->entries.size() >= JSON_FILE_CACHE_MAX_FILES) {
+        auto victim = cache->entries.end();
+        for (auto it = cache->entries.begin(); it != cache->entries.end(); ++it) {
+            if (it->second.pass == cache->pass) continue;
+            if (victim == cache->entries.end() || it->second.last_used < victim->second.last_used) victim = it;
+        }
+        if (victim == cache->entries.end()) return;
+        cJSON_Delete(victim->second.json);
+        cache->entries.erase(victim);
+        profiler_count("json cache evictions");
+    }
+}
+
+static uint64_t json_file_cache_hash(const char *data, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char) data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void json_file_cache_store(JsonFileCache *cache, const char *filename, uint64_t size, uint64_t mtime_ms,
+                                  uint64_t hash, uint64_t read_at_ms, JsonKeyFilter filter, void *ctx, cJSON *json) {
+    json_file_cache_evict(cache);
+    JsonFileCacheEntry entry;
+    entry.size = size;
+    entry.mtime_ms = mtime_ms;
+    entry.hash = hash;
+    entry.read_at_ms = read_at_ms;
+    entry.filter = filter;
+    entry.ctx = ctx;
+    entry.json = json;
+    json_file_cache_touch(cache, entry);
+    cache->entries[filename] = entry;
+}
+
+JsonFileCache *json_file_cache_new(void) {
+    return new JsonFileCache();
+}
+
+void json_file_cache_begin_pass(JsonFileCache *cache) {
+    if (cache) cache->pass++;
+}
+
+void json_file_cache_clear(JsonFileCache *cache) {
+    if (!cache) return;
+    for (auto &kv: cache->entries) cJSON_Delete(kv.second.json);
+    cache->entries.clear();
+}
+
+void json_file_cache_free(JsonFileCache *cache) {
+    json_file_cache_clear(cache);
+    delete cache;
+}
+
+cJSON *json_file_cache_get(JsonFileCache *cache, const char *filename, JsonKeyFilter filter, void *ctx) {
+    if (!filename || filename[0] == '\0') return nullptr;
+    if (!cache) return nullptr;
+
+    auto it = cache->entries.find(filename);
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        // Missing (or mid-save): forget it, like cJSON_from_file returning nullptr
+        if (it != cache->entries.end()) {
+            cJSON_Delete(it->second.json);
+            cache->entries.erase(it);
+        }
+        return nullptr;
+    }
+    uint64_t size = (uint64_t) st.st_size;
+    uint64_t mtime_ms = get_file_mtime_ms(filename);
+    bool same_parse = it != cache->entries.end() && it->second.filter == filter && it->second.ctx == ctx;
+
+    // Unchanged size and mtime, and the mtime is safely older than our read
+    if (same_parse && it->second.size == size && it->second.mtime_ms == mtime_ms &&
+        mtime_ms + JSON_FILE_CACHE_RACY_MS < it->second.read_at_ms) {
+        profiler_count("json cache stat hits");
+        json_file_cache_touch(cache, it->second);
+        return it->second.json;
+    }
+
+    size_t length = 0;
+    char *buffer = read_file_to_buffer(filename, &length);
+    if (!buffer) {
+        if (it != cache->entries.end()) {
+            cJSON_Delete(it->second.json);
+            cache->entries.erase(it);
+        }
+        return nullptr;
+    }
+    uint64_t hash = json_file_cache_hash(buffer, length);
+    uint64_t now_ms = (uint64_t) time(nullptr) * 1000ULL;
+
+    // Touched but not changed (an editor re-saving, the game rewriting identical data)
+    if (same_parse && it->second.size == length && it->second.hash == hash) {
+        free(buffer);
+        it->second.mtime_ms = mtime_ms;
+        it->second.read_at_ms = now_ms;
+        profiler_count("json cache hash hits");
+        json_file_cache_touch(cache, it->second);
+        return it->second.json;
+    }
+
+    cJSON *json = json_from_buffer_filtered(buffer, length, filename, filter, ctx);
+    free(buffer);
+    profiler_count("json cache parses");
+
+    if (it != cache->entries.end()) {
+        cJSON_Delete(it->second.json);
+        cache->entries.erase(it);
+    }
+    if (!json) return nullptr;
+
+    json_file_cache_store(cache, filename, length, mtime_ms, hash, now_ms, filter, ctx, json);
+    return json;
+}
+
+void json_file_cache_put(JsonFileCache *cache, const char *filename, JsonKeyFilter filter, void *ctx, cJSON *json) {
+    if (!cache || !filename || filename[0] == '\0' || !json) {
+        cJSON_Delete(json);
+        return;
+    }
+    auto it = cache->entries.find(filename);
+    if (it != cache->entries.end()) {
+        cJSON_Delete(it->second.json);
+        cache->entries.erase(it);
+    }
+
+    size_t length = 0;
+    char *buffer = read_file_to_buffer(filename, &length);
+    if (!buffer) {
+        cJSON_Delete(json);
+        return;
+    }
+    uint64_t hash = json_file_cache_hash(buffer, length);
+    free(buffer);
+    json_file_cache_store(cache, filename, length, get_file_mtime_ms(filename), hash,
+                          (uint64_t) time(nullptr) * 1000ULL, filter, ctx, json);
+}
+
+bool fs_sync_file(FILE *f) {
+    if (!f || fflush(f) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(f)) == 0;
+#else
+    return fsync(fileno(f)) == 0;
+#endif
+}
+
 bool cJSON_write_to_file_atomic(const char *filename, const cJSON *root) {
     if (!filename || !root) return false;
 
@@ -159,14 +540,7 @@ bool cJSON_write_to_file_atomic(const char *filename, const cJSON *root) {
 
     // Flush stdio buffers, then force the bytes to physical storage before the
     // rename so a crash or power loss can't leave a renamed-but-empty file.
-    if (ok && fflush(f) != 0) ok = false;
-    if (ok) {
-#ifdef _WIN32
-        if (_commit(_fileno(f)) != 0) ok = false;
-#else
-        if (fsync(fileno(f)) != 0) ok = false;
-#endif
-    }
+    if (ok && !fs_sync_file(f)) ok = false;
     if (fclose(f) != 0) ok = false;
 
     if (!ok) {
@@ -16,6 +16,7 @@ extern "C" {
 
 #include <cJSON.h>
 #include <stdbool.h>
+#include <stdio.h> // FILE
 
 
 /**
@@ -29,6 +30,85 @@ extern "C" {
  */
 cJSON *cJSON_from_file(const char *filename);
 
+// What cJSON_from_file_filtered does with one object member
+typedef enum {
+    JSON_FILTER_SKIP, // Scan past the value without allocating anything for it
+    JSON_FILTER_KEEP, // Materialise the value and everything below it
+    JSON_FILTER_DESCEND, // Materialise an object value but ask again for each of its members (else KEEP)
+} JsonFilterAction;
+
+/**
+ * @brief Decides the fate of one object member while streaming a JSON file.
+ * @param ctx The context passed to cJSON_from_file_filtered.
+ * @param depth 0 for members of the root object, 1 for members of a DESCENDed root member, ...
+ * @param parent_key Key of the enclosing member (nullptr at depth 0).
+ * @param key The member's key, unescaped.
+ */
+typedef JsonFilterAction (*JsonKeyFilter)(void *ctx, int depth, const char *parent_key, const char *key);
+
+/**
+ * @brief Reads a JSON file like cJSON_from_file, but streams over it and only builds cJSON nodes
+ * for the members the filter keeps, so large files of which little is read stay cheap to load.
+ * Files whose root is not an object are parsed in full.
+ *
+ * @param filename The path to the JSON file.
+ * @param filter Called for every member of the root object and of every DESCENDed object.
+ * @param ctx Passed through to the filter.
+ * @return The pruned cJSON object, or NULL on failure. Free it with cJSON_Delete().
+ */
+cJSON *cJSON_from_file_filtered(const char *filename, JsonKeyFilter filter, void *ctx);
+
+// Parsed JSON files keyed by path, reused while a file's fingerprint (size, mtime, hash of its bytes) is unchanged
+typedef struct JsonFileCache JsonFileCache;
+
+/** @brief Creates an empty JSON file cache. Free it with json_file_cache_free(). */
+JsonFileCache *json_file_cache_new(void);
+
+/** @brief Frees every cached cJSON object and the cache itself. */
+void json_file_cache_free(JsonFileCache *cache);
+
+/** @brief Drops every cached file, e.g. when the keys a filter tests for have changed. */
+void json_file_cache_clear(JsonFileCache *cache);
+
+/**
+ * @brief Starts a new pass, e.g. one tracker update. Trees returned during the current pass stay valid until it
+ * ends, so when the cache is full only files of earlier passes are evicted to make room.
+ */
+void json_file_cache_begin_pass(JsonFileCache *cache);
+
+/**
+ * @brief Returns the parsed contents of a JSON file, re-reading it only when it changed since the last call.
+ * Unchanged size and mtime skip the read entirely (unless the file was written within the filesystem's mtime
+ * resolution of that read); otherwise the bytes are hashed and only parsed again if the hash differs.
+ *
+ * @param cache The cache to look in.
+ * @param filename The path to the JSON file.
+ * @param filter Optional key filter (see cJSON_from_file_filtered), nullptr to parse the whole file.
+ * @param ctx Passed through to the filter. A different filter or ctx than the cached parse re-parses the file.
+ * @return The cached cJSON object, or NULL if the file is missing or malformed. It is owned by the cache:
+ * never modify or delete it, and don't use it past the next call for the same file, the next pass or a clear.
+ */
+cJSON *json_file_cache_get(JsonFileCache *cache, const char *filename, JsonKeyFilter filter, void *ctx);
+
+/**
+ * @brief Records json as the parsed contents of a file that was just written, so the next
+ * json_file_cache_get for it doesn't read back what the caller already has in memory.
+ * The file is read once to fingerprint it, but not parsed.
+ *
+ * @param cache The cache to store in.
+ * @param filename The path that was written.
+ * @param filter The filter json corresponds to (as json_file_cache_get would be called with).
+ * @param ctx The filter's ctx.
+ * @param json The parsed contents. Ownership passes to the cache (it is freed if the file can't be read).
+ */
+void json_file_cache_put(JsonFileCache *cache, const char *filename, JsonKeyFilter filter, void *ctx, cJSON *json);
+
+/**
+ * @brief Flushes a stdio stream and forces its bytes to physical storage (fsync / _commit).
+ * @return true on success, false if the flush or the sync failed.
+ */
+bool fs_sync_file(FILE *f);
+
 /**
  * @brief Atomically writes a cJSON object to a file.
  * The data is first written to a unique temporary file in the same directory,
@@ -105,7 +105,7 @@ bool hotkey_apply_counter_action(Tracker *t, AppSettings *app_settings,
         return true;
     }
 
-    // Singleplayer: direct in-memory mutation + save.
+    // Singleplayer: direct in-memory mutation + journal.
     if (mod_action == COOP_MOD_TOGGLE) {
         // Mirrors clicking the goal on the map. Clearing the flag drops "done" as well; the re-read
         // triggered below puts it back when linked goals still satisfy the goal on their own.
@@ -125,8 +125,11 @@ bool hotkey_apply_counter_action(Tracker *t, AppSettings *app_settings,
             target_goal->done = (target_goal->progress >= target_goal->goal);
         }
     }
-    SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-    settings_save(app_settings, t->template_data, SAVE_CONTEXT_ALL);
+    // Journaled rather than saved: a counter hotkey held down must not rewrite settings.json per step
+    if (!settings_progress_journal_custom_goal(app_settings->local_player.uuid, target_goal)) {
+        SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
+        settings_save(app_settings, t->template_data, SAVE_CONTEXT_ALL);
+    }
     SDL_SetAtomicInt(&g_coop_broadcast_needed, 1);
     SDL_SetAtomicInt(&g_game_data_changed, 1);
     return true;
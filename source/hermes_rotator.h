@@ -45,6 +45,27 @@
 #include <string>
 #include <vector>
 
+// Vectorised decode kernels. x86 picks SSSE3 or AVX2 at runtime (the build targets baseline
+// x86-64), AArch64 always has NEON. Everything else uses the scalar reference.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HERMES_ROTATOR_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h> // __cpuid, __cpuidex
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HERMES_ROTATOR_NEON 1
+#include <arm_neon.h>
+#endif
+
+// GCC and Clang only emit SSSE3/AVX2 instructions inside functions marked for them,
+// MSVC allows the intrinsics everywhere.
+#if defined(HERMES_ROTATOR_X86) && (defined(__GNUC__) || defined(__clang__))
+#define HERMES_ROTATOR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define HERMES_ROTATOR_TARGET(isa)
+#endif
+
 // ============================================================
 //  JavaRandom
 //
@@ -94,6 +115,9 @@ class HermesRotator {
     static constexpr int64_t SHUFFLE_SEED = 7499203634667178692LL;
 
     uint8_t substitutionTable_[N];
+    // substitutionTable_ padded to six 16-byte shuffle tables (the two pad bytes are never selected).
+    uint8_t simdTable_[96];
+    int simdLevel_; // 0 = scalar, 1 = SSSE3 / NEON, 2 = AVX2
 
     void buildTables() {
         uint8_t chars[N];
@@ -114,32 +138,226 @@ class HermesRotator {
         const int shift = N / 2;
         for (int i = 0; i < N; i++)
             substitutionTable_[chars[i] - MIN_VAL] = chars[(i + shift) % N];
+
+        memset(simdTable_, 0, sizeof(simdTable_));
+        memcpy(simdTable_, substitutionTable_, N);
     }
 
-    static void halfReverse_(uint8_t *bytes, int len) {
-        for (int i = 0; i < len / 2; i += 2) {
+    static int detectSimdLevel_() {
+#if defined(HERMES_ROTATOR_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuid(regs, 0);
+        int max_leaf = regs[0];
+        __cpuid(regs, 1);
+        bool ssse3 = (regs[2] & (1 << 9)) != 0;
+        bool avx_os = (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+        bool avx2 = false;
+        if (max_leaf >= 7 && avx_os) {
+            __cpuidex(regs, 7, 0);
+            avx2 = (regs[1] & (1 << 5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        bool ssse3 = __builtin_cpu_supports("ssse3");
+        bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+        return avx2 ? 2 : ssse3 ? 1 : 0;
+#elif defined(HERMES_ROTATOR_NEON)
+        return 1;
+#else
+        return 0;
+#endif
+    }
+
+    // Swaps every even index i < len / 2 with its mirror len - 1 - i. The swaps are independent of
+    // each other, so the kernels do whole blocks from both ends and leave the rest to this, starting at
+    // their (even) block boundary.
+    static void halfReverse_(uint8_t *bytes, int len, int from = 0) {
+        for (int i = from; i < len / 2; i += 2) {
             uint8_t tmp = bytes[i];
             bytes[i] = bytes[len - 1 - i];
             bytes[len - 1 - i] = tmp;
         }
     }
 
-    void applySubstitution_(uint8_t *bytes, int len) const {
-        for (int i = 0; i < len; i++) {
+    void applySubstitution_(uint8_t *bytes, int len, int from = 0) const {
+        for (int i = from; i < len; i++) {
             uint8_t c = bytes[i];
             if (c >= MIN_VAL && c <= MAX_VAL)
                 bytes[i] = substitutionTable_[c - MIN_VAL];
         }
     }
 
+#if defined(HERMES_ROTATOR_X86)
+    // Table lookup for 16 bytes: pshufb in each of the six 16-entry tables, keeping the one
+    // matching the index's high nibble. Bytes outside [MIN_VAL, MAX_VAL] pass through.
+    HERMES_ROTATOR_TARGET("ssse3")
+    __m128i substitute16_(__m128i c) const {
+        const __m128i idx = _mm_sub_epi8(c, _mm_set1_epi8((char) MIN_VAL));
+        const __m128i valid = _mm_cmpeq_epi8(_mm_min_epu8(idx, _mm_set1_epi8((char) (N - 1))), idx);
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(idx, 4), nibble);
+        const __m128i lo = _mm_and_si128(idx, nibble);
+        __m128i out = _mm_setzero_si128();
+        for (int g = 0; g < 6; g++) {
+            const __m128i table = _mm_loadu_si128((const __m128i *) (simdTable_ + 16 * g));
+            const __m128i in_group = _mm_cmpeq_epi8(hi, _mm_set1_epi8((char) g));
+            out = _mm_or_si128(out, _mm_and_si128(in_group, _mm_shuffle_epi8(table, lo)));
+        }
+        return _mm_or_si128(_mm_and_si128(valid, out), _mm_andnot_si128(valid, c));
+    }
+
+    HERMES_ROTATOR_TARGET("ssse3")
+    void processLineSsse3_(uint8_t *bytes, int len) const {
+        const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        const __m128i even = _mm_setr_epi8(-1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0);
+        int i = 0;
+        for (; i + 16 <= len / 2; i += 16) {
+            uint8_t *back = bytes + len - 16 - i;
+            __m128i front = _mm_loadu_si128((const __m128i *) (bytes + i));
+            __m128i mirror = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) back), reverse);
+            __m128i new_front = _mm_or_si128(_mm_and_si128(even, mirror), _mm_andnot_si128(even, front));
+            __m128i new_mirror = _mm_or_si128(_mm_and_si128(even, front), _mm_andnot_si128(even, mirror));
+            _mm_storeu_si128((__m128i *) (bytes + i), new_front);
+            _mm_storeu_si128((__m128i *) back, _mm_shuffle_epi8(new_mirror, reverse));
+        }
+        halfReverse_(bytes, len, i);
+
+        i = 0;
+        for (; i + 16 <= len; i += 16) {
+            __m128i c = _mm_loadu_si128((const __m128i *) (bytes + i));
+            _mm_storeu_si128((__m128i *) (bytes + i), substitute16_(c));
+        }
+        applySubstitution_(bytes, len, i);
+    }
+
+    HERMES_ROTATOR_TARGET("avx2")
+    void processLineAvx2_(uint8_t *bytes, int len) const {
+        // vpshufb works per 128-bit lane: reverse both lanes, then swap them.
+        const __m256i lane_reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                      15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        const __m256i even = _mm256_set1_epi16(0x00FF);
+        int i = 0;
+        for (; i + 32 <= len / 2; i += 32) {
+            uint8_t *back = bytes + len - 32 - i;
+            __m256i front = _mm256_loadu_si256((const __m256i *) (bytes + i));
+            __m256i mirror = _mm256_permute4x64_epi64(
+                _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) back), lane_reverse), 0x4E);
+            __m256i new_front = _mm256_blendv_epi8(front, mirror, even);
+            __m256i new_mirror = _mm256_blendv_epi8(mirror, front, even);
+            _mm256_storeu_si256((__m256i *) (bytes + i), new_front);
+            _mm256_storeu_si256((__m256i *) back,
+                                _mm256_permute4x64_epi64(_mm256_shuffle_epi8(new_mirror, lane_reverse), 0x4E));
+        }
+        halfReverse_(bytes, len, i);
+
+        __m256i tables[6];
+        for (int g = 0; g < 6; g++)
+            tables[g] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) (simdTable_ + 16 * g)));
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        i = 0;
+        for (; i + 32 <= len; i += 32) {
+            const __m256i c = _mm256_loadu_si256((const __m256i *) (bytes + i));
+            const __m256i idx = _mm256_sub_epi8(c, _mm256_set1_epi8((char) MIN_VAL));
+            const __m256i valid = _mm256_cmpeq_epi8(_mm256_min_epu8(idx, _mm256_set1_epi8((char) (N - 1))), idx);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(idx, 4), nibble);
+            const __m256i lo = _mm256_and_si256(idx, nibble);
+            __m256i out = _mm256_setzero_si256();
+            for (int g = 0; g < 6; g++) {
+                const __m256i in_group = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8((char) g));
+                out = _mm256_or_si256(out, _mm256_and_si256(in_group, _mm256_shuffle_epi8(tables[g], lo)));
+            }
+            _mm256_storeu_si256((__m256i *) (bytes + i), _mm256_blendv_epi8(c, out, valid));
+        }
+        for (; i + 16 <= len; i += 16) {
+            __m128i c = _mm_loadu_si128((const __m128i *) (bytes + i));
+            _mm_storeu_si128((__m128i *) (bytes + i), substitute16_(c));
+        }
+        applySubstitution_(bytes, len, i);
+    }
+#elif defined(HERMES_ROTATOR_NEON)
+    static uint8x16_t reverse16_(uint8x16_t v) {
+        v = vrev64q_u8(v);
+        return vextq_u8(v, v, 8);
+    }
+
+    void processLineNeon_(uint8_t *bytes, int len) const {
+        static const uint8_t even_bytes[16] = {
+            0xFF, 0, 0xFF, 0, 0xFF, 0, 0xFF, 0, 0xFF, 0, 0xFF, 0, 0xFF, 0, 0xFF, 0
+        };
+        const uint8x16_t even = vld1q_u8(even_bytes);
+        int i = 0;
+        for (; i + 16 <= len / 2; i += 16) {
+            uint8_t *back = bytes + len - 16 - i;
+            uint8x16_t front = vld1q_u8(bytes + i);
+            uint8x16_t mirror = reverse16_(vld1q_u8(back));
+            vst1q_u8(bytes + i, vbslq_u8(even, mirror, front));
+            vst1q_u8(back, reverse16_(vbslq_u8(even, front, mirror)));
+        }
+        halfReverse_(bytes, len, i);
+
+        // tbl returns 0 and tbx keeps the input for out-of-range indices, so two lookups cover
+        // all 96 entries: indices below 64 wrap to >= 192 in the second one and are left alone.
+        uint8x16x4_t low_tables;
+        low_tables.val[0] = vld1q_u8(simdTable_);
+        low_tables.val[1] = vld1q_u8(simdTable_ + 16);
+        low_tables.val[2] = vld1q_u8(simdTable_ + 32);
+        low_tables.val[3] = vld1q_u8(simdTable_ + 48);
+        uint8x16x2_t high_tables;
+        high_tables.val[0] = vld1q_u8(simdTable_ + 64);
+        high_tables.val[1] = vld1q_u8(simdTable_ + 80);
+        i = 0;
+        for (; i + 16 <= len; i += 16) {
+            uint8x16_t c = vld1q_u8(bytes + i);
+            uint8x16_t idx = vsubq_u8(c, vdupq_n_u8(MIN_VAL));
+            uint8x16_t valid = vcltq_u8(idx, vdupq_n_u8(N));
+            uint8x16_t out = vqtbl4q_u8(low_tables, idx);
+            out = vqtbx2q_u8(out, high_tables, vsubq_u8(idx, vdupq_n_u8(64)));
+            vst1q_u8(bytes + i, vbslq_u8(valid, out, c));
+        }
+        applySubstitution_(bytes, len, i);
+    }
+#endif
+
 public:
-    HermesRotator() { buildTables(); }
+    HermesRotator() : simdLevel_(detectSimdLevel_()) { buildTables(); }
 
-    void processLine(uint8_t *bytes, int len) const {
+    // Kernel processLine() dispatches to (0 = scalar, 1 = SSSE3 / NEON, 2 = AVX2).
+    int simdLevel() const { return simdLevel_; }
+
+    // Caps the kernel at level, never above what the CPU supports. Lets the equivalence test
+    // (tests/hermes_rotator_equivalence.cpp) run every kernel the host has.
+    void limitSimdLevel(int level) {
+        int supported = detectSimdLevel_();
+        simdLevel_ = level < 0 ? 0 : level < supported ? level : supported;
+    }
+
+    // Scalar reference decode, what the vectorised kernels must match byte for byte.
+    void processLineScalar(uint8_t *bytes, int len) const {
         halfReverse_(bytes, len);
         applySubstitution_(bytes, len);
     }
 
+    void processLine(uint8_t *bytes, int len) const {
+#if defined(HERMES_ROTATOR_X86)
+        if (simdLevel_ >= 2) {
+            processLineAvx2_(bytes, len);
+            return;
+        }
+        if (simdLevel_ >= 1) {
+            processLineSsse3_(bytes, len);
+            return;
+        }
+#elif defined(HERMES_ROTATOR_NEON)
+        if (simdLevel_ >= 1) {
+            processLineNeon_(bytes, len);
+            return;
+        }
+#endif
+        processLineScalar(bytes, len);
+    }
+
     std::string processLine(const std::string &line) const {
         std::string out = line;
         if (!out.empty() && out.back() == '\r')
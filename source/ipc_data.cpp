@@ -0,0 +1,1095 @@
+// Copyright (c) 2026 LNXSeus. All Rights Reserved.
+//
+// This project is proprietary software. You are granted a license to use the software as-is.
+// You may not copy, distribute, modify, reverse-engineer, maintain a fork, or use this software
+// or its source code in any way without the express written permission of the copyright holder.
+//
+// Created by Linus on 16.10.2026.
+//
+
+#include "ipc_data.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h> // For O_* constants
+#include <sys/mman.h> // For shm_open/mmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h> // For ftruncate, close
+#endif
+
+#ifdef __linux__
+#include <ctime> // For timespec
+#include <linux/futex.h> // For FUTEX_WAIT/FUTEX_WAKE
+#include <sys/syscall.h> // For SYS_futex
+#endif
+
+// Every section starts on this boundary so the records inside it stay naturally aligned.
+#define IPC_IMAGE_ALIGN 16
+
+static size_t image_align(size_t v) {
+    return (v + IPC_IMAGE_ALIGN - 1) & ~(size_t) (IPC_IMAGE_ALIGN - 1);
+}
+
+// Write cursors for one image: the next free offset in each fixed-stride section, plus the
+// relocation table that collects the position of every pointer word written.
+typedef struct {
+    char *base;
+    size_t slot_cur; // Pointer-array slots (TrackableCategory *, TrackableItem *, ...)
+    size_t cat_cur; // TrackableCategory records (advancements, then stats)
+    size_t item_cur; // TrackableItem records (criteria, unlocks, custom goals)
+    size_t msg_cur; // MultiStageGoal records
+    size_t stage_cur; // SubGoal records
+    size_t counter_cur; // CounterGoal records
+    size_t link_cur; // CounterLinkedGoal records
+    size_t *relocs;
+    uint32_t reloc_count;
+} ImageWriter;
+
+static size_t image_take(size_t *cursor, size_t bytes) {
+    size_t at = *cursor;
+    *cursor += bytes;
+    return at;
+}
+
+// Stores an image offset in a pointer word and records the word for relocation.
+static void image_link(ImageWriter *w, void *word, size_t target_offset) {
+    uintptr_t v = (uintptr_t) target_offset;
+    memcpy(word, &v, sizeof(v));
+    w->relocs[w->reloc_count++] = (size_t) ((char *) word - w->base);
+}
+
+static void *image_slot(ImageWriter *w, size_t array_offset, int index) {
+    return w->base + array_offset + (size_t) index * sizeof(uintptr_t);
+}
+
+static size_t image_put_item(ImageWriter *w, const TrackableItem *src) {
+    size_t at = image_take(&w->item_cur, sizeof(TrackableItem));
+    TrackableItem *dst = (TrackableItem *) (w->base + at);
+    memcpy(dst, src, sizeof(TrackableItem));
+    dst->texture = nullptr;
+    dst->anim_texture = nullptr;
+    dst->linked_goals = nullptr;
+    dst->linked_goal_count = 0;
+    return at;
+}
+
+static size_t image_put_category(ImageWriter *w, const TrackableCategory *src) {
+    size_t at = image_take(&w->cat_cur, sizeof(TrackableCategory));
+    TrackableCategory *dst = (TrackableCategory *) (w->base + at);
+    memcpy(dst, src, sizeof(TrackableCategory));
+    dst->texture = nullptr;
+    dst->anim_texture = nullptr;
+    dst->texture_bg = nullptr;
+    dst->texture_bg_half_done = nullptr;
+    dst->texture_bg_done = nullptr;
+    dst->linked_goals = nullptr;
+    dst->linked_goal_count = 0;
+    dst->criteria = nullptr;
+    if (src->criteria_count <= 0 || !src->criteria) {
+        dst->criteria_count = 0;
+        return at;
+    }
+
+    size_t arr = image_take(&w->slot_cur, (size_t) src->criteria_count * sizeof(uintptr_t));
+    image_link(w, &dst->criteria, arr);
+    for (int j = 0; j < src->criteria_count; j++) {
+        image_link(w, image_slot(w, arr, j), image_put_item(w, src->criteria[j]));
+    }
+    return at;
+}
+
+static size_t image_put_multi_stage(ImageWriter *w, const MultiStageGoal *src) {
+    size_t at = image_take(&w->msg_cur, sizeof(MultiStageGoal));
+    MultiStageGoal *dst = (MultiStageGoal *) (w->base + at);
+    memcpy(dst, src, sizeof(MultiStageGoal));
+    dst->texture = nullptr;
+    dst->anim_texture = nullptr;
+    dst->stages = nullptr;
+    if (src->stage_count <= 0 || !src->stages) {
+        dst->stage_count = 0;
+        return at;
+    }
+
+    size_t arr = image_take(&w->slot_cur, (size_t) src->stage_count * sizeof(uintptr_t));
+    image_link(w, &dst->stages, arr);
+    for (int j = 0; j < src->stage_count; j++) {
+        size_t stage_at = image_take(&w->stage_cur, sizeof(SubGoal));
+        SubGoal *stage = (SubGoal *) (w->base + stage_at);
+        memcpy(stage, src->stages[j], sizeof(SubGoal));
+        stage->texture = nullptr;
+        stage->anim_texture = nullptr;
+        stage->linked_goals = nullptr;
+        stage->linked_goal_count = 0;
+        image_link(w, image_slot(w, arr, j), stage_at);
+    }
+    return at;
+}
+
+static size_t image_put_counter(ImageWriter *w, const CounterGoal *src) {
+    size_t at = image_take(&w->counter_cur, sizeof(CounterGoal));
+    CounterGoal *dst = (CounterGoal *) (w->base + at);
+    memcpy(dst, src, sizeof(CounterGoal));
+    dst->texture = nullptr;
+    dst->anim_texture = nullptr;
+    dst->linked_goals = nullptr;
+    if (src->linked_goal_count <= 0 || !src->linked_goals) {
+        dst->linked_goal_count = 0;
+        return at;
+    }
+
+    size_t links = image_take(&w->link_cur, (size_t) src->linked_goal_count * sizeof(CounterLinkedGoal));
+    memcpy(w->base + links, src->linked_goals, (size_t) src->linked_goal_count * sizeof(CounterLinkedGoal));
+    image_link(w, &dst->linked_goals, links);
+    return at;
+}
+
+// Section offsets of one image, derived from the record counts of a TemplateData.
+typedef struct {
+    size_t template_offset;
+    size_t slot_offset;
+    size_t cat_offset;
+    size_t item_offset;
+    size_t msg_offset;
+    size_t stage_offset;
+    size_t counter_offset;
+    size_t link_offset;
+    size_t reloc_offset;
+    size_t image_size; // Upper bound: assumes every pointer word needs a relocation
+} ImageLayout;
+
+static void image_layout(const TemplateData *td, ImageLayout *l) {
+    // Count the records of every section so the layout is known before anything is written.
+    size_t criteria = 0, stages = 0, links = 0;
+    for (int i = 0; i < td->advancement_count; i++) criteria += td->advancements[i]->criteria_count;
+    for (int i = 0; i < td->stat_count; i++) criteria += td->stats[i]->criteria_count;
+    for (int i = 0; i < td->multi_stage_goal_count; i++) stages += td->multi_stage_goals[i]->stage_count;
+    for (int i = 0; i < td->counter_goal_count; i++) links += td->counter_goals[i]->linked_goal_count;
+
+    size_t categories = (size_t) td->advancement_count + td->stat_count;
+    size_t items = criteria + td->unlock_count + td->custom_goal_count;
+    size_t slots = categories + items + td->multi_stage_goal_count + stages + td->counter_goal_count;
+    // One word per slot, the six TemplateData arrays and the criteria/stages/linked_goals of each parent.
+    size_t max_relocs = slots + 6 + categories + td->multi_stage_goal_count + td->counter_goal_count;
+
+    // Lay the sections out back to back.
+    size_t off = image_align(sizeof(IPCTemplateImage));
+    l->template_offset = off;
+    off = image_align(off + sizeof(TemplateData));
+    l->slot_offset = off;
+    off = image_align(off + slots * sizeof(uintptr_t));
+    l->cat_offset = off;
+    off = image_align(off + categories * sizeof(TrackableCategory));
+    l->item_offset = off;
+    off = image_align(off + items * sizeof(TrackableItem));
+    l->msg_offset = off;
+    off = image_align(off + (size_t) td->multi_stage_goal_count * sizeof(MultiStageGoal));
+    l->stage_offset = off;
+    off = image_align(off + stages * sizeof(SubGoal));
+    l->counter_offset = off;
+    off = image_align(off + (size_t) td->counter_goal_count * sizeof(CounterGoal));
+    l->link_offset = off;
+    off = image_align(off + links * sizeof(CounterLinkedGoal));
+    l->reloc_offset = off;
+    l->image_size = off + max_relocs * sizeof(size_t);
+}
+
+size_t ipc_template_image_size(const TemplateData *td) {
+    if (!td) return 0;
+    ImageLayout layout;
+    image_layout(td, &layout);
+    return layout.image_size;
+}
+
+size_t ipc_write_template_image(const TemplateData *td, char *dst, size_t capacity) {
+    if (!td || !dst) return 0;
+
+    // 1. Counts and section offsets.
+    ImageLayout layout;
+    image_layout(td, &layout);
+    size_t template_offset = layout.template_offset;
+    size_t reloc_offset = layout.reloc_offset;
+
+    if (layout.image_size > capacity) return 0;
+
+    ImageWriter w;
+    w.base = dst;
+    w.slot_cur = layout.slot_offset;
+    w.cat_cur = layout.cat_offset;
+    w.item_cur = layout.item_offset;
+    w.msg_cur = layout.msg_offset;
+    w.stage_cur = layout.stage_offset;
+    w.counter_cur = layout.counter_offset;
+    w.link_cur = layout.link_offset;
+    w.relocs = (size_t *) (dst + reloc_offset);
+    w.reloc_count = 0;
+
+    // 2. The TemplateData record itself. Decorations only matter to the tracker's manual layout.
+    TemplateData *out = (TemplateData *) (dst + template_offset);
+    memcpy(out, td, sizeof(TemplateData));
+    out->decorations = nullptr;
+    out->decoration_count = 0;
+    out->linked_goal_graph = nullptr;
+    out->advancement_match_index = nullptr;
+    out->player_file_keys = nullptr;
+    out->string_pool = nullptr;
+    out->hermes_stat_index = nullptr;
+    out->arena = nullptr;
+    out->advancements = nullptr;
+    out->stats = nullptr;
+    out->unlocks = nullptr;
+    out->custom_goals = nullptr;
+    out->multi_stage_goals = nullptr;
+    out->counter_goals = nullptr;
+
+    // 3. Each top-level pointer array, followed by the records it points at.
+    if (td->advancement_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->advancement_count * sizeof(uintptr_t));
+        image_link(&w, &out->advancements, arr);
+        for (int i = 0; i < td->advancement_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_category(&w, td->advancements[i]));
+    }
+    if (td->stat_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->stat_count * sizeof(uintptr_t));
+        image_link(&w, &out->stats, arr);
+        for (int i = 0; i < td->stat_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_category(&w, td->stats[i]));
+    }
+    if (td->multi_stage_goal_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->multi_stage_goal_count * sizeof(uintptr_t));
+        image_link(&w, &out->multi_stage_goals, arr);
+        for (int i = 0; i < td->multi_stage_goal_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_multi_stage(&w, td->multi_stage_goals[i]));
+    }
+    if (td->unlock_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->unlock_count * sizeof(uintptr_t));
+        image_link(&w, &out->unlocks, arr);
+        for (int i = 0; i < td->unlock_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_item(&w, td->unlocks[i]));
+    }
+    if (td->custom_goal_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->custom_goal_count * sizeof(uintptr_t));
+        image_link(&w, &out->custom_goals, arr);
+        for (int i = 0; i < td->custom_goal_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_item(&w, td->custom_goals[i]));
+    }
+    if (td->counter_goal_count > 0) {
+        size_t arr = image_take(&w.slot_cur, (size_t) td->counter_goal_count * sizeof(uintptr_t));
+        image_link(&w, &out->counter_goals, arr);
+        for (int i = 0; i < td->counter_goal_count; i++)
+            image_link(&w, image_slot(&w, arr, i), image_put_counter(&w, td->counter_goals[i]));
+    }
+
+    // 4. Header last, so a reader only ever sees the magic on a finished image.
+    IPCTemplateImage *hdr = (IPCTemplateImage *) dst;
+    hdr->reloc_count = w.reloc_count;
+    hdr->image_size = reloc_offset + (size_t) w.reloc_count * sizeof(size_t);
+    hdr->template_offset = template_offset;
+    hdr->reloc_offset = reloc_offset;
+    hdr->relocated_base = 0;
+    hdr->magic = IPC_TEMPLATE_IMAGE_MAGIC;
+    return hdr->image_size;
+}
+
+TemplateData *ipc_attach_template_image(char *image, size_t available) {
+    if (!image || available < sizeof(IPCTemplateImage)) return nullptr;
+
+    IPCTemplateImage *hdr = (IPCTemplateImage *) image;
+    if (hdr->magic != IPC_TEMPLATE_IMAGE_MAGIC || hdr->image_size > available) return nullptr;
+    if (hdr->template_offset + sizeof(TemplateData) > hdr->image_size) return nullptr;
+    if (hdr->reloc_offset + (size_t) hdr->reloc_count * sizeof(size_t) > hdr->image_size) return nullptr;
+
+    uintptr_t base = (uintptr_t) image;
+    if (hdr->relocated_base != base) {
+        const size_t *relocs = (const size_t *) (image + hdr->reloc_offset);
+        // Validate the whole table first so a corrupt image is rejected untouched, not half-patched.
+        for (uint32_t i = 0; i < hdr->reloc_count; i++) {
+            if (relocs[i] + sizeof(uintptr_t) > hdr->reloc_offset) return nullptr;
+        }
+        // Unsigned wrap-around makes this correct for both directions of a re-base.
+        uintptr_t delta = base - hdr->relocated_base;
+        for (uint32_t i = 0; i < hdr->reloc_count; i++) {
+            uintptr_t v;
+            memcpy(&v, image + relocs[i], sizeof(v));
+            v += delta;
+            memcpy(image + relocs[i], &v, sizeof(v));
+        }
+        hdr->relocated_base = base;
+    }
+    return (TemplateData *) (image + hdr->template_offset);
+}
+
+// --------- LOCK-FREE PUBLISHING ---------
+// Single writer (tracker), single reader (overlay). SDL atomics are sequentially consistent, which
+// is what the slot handshake below relies on.
+
+// How often the overlay retries a header read while the tracker is rewriting it before it gives up
+// for this frame and keeps the header it already has.
+#define IPC_HEADER_READ_RETRIES 64
+
+void ipc_shared_init(SharedData *shared) {
+    SDL_SetAtomicInt(&shared->shutdown_requested, 0);
+    SDL_SetAtomicInt(&shared->publish_generation, 0);
+    SDL_SetAtomicInt(&shared->header_seq, 0);
+    SDL_SetAtomicInt(&shared->latest_slot, -1);
+    SDL_SetAtomicInt(&shared->reader_slot, -1);
+    SDL_SetAtomicInt(&shared->body_generation, 0);
+}
+
+bool ipc_publish_header(SharedData *shared, const OverlayIPCHeader *header) {
+    // Only the tracker writes, so comparing against the published copy needs no seqlock round.
+    if (SDL_GetAtomicInt(&shared->header_seq) != 0 &&
+        memcmp(&shared->header, header, sizeof(OverlayIPCHeader)) == 0) {
+        return false;
+    }
+    SDL_AddAtomicInt(&shared->header_seq, 1); // Odd: readers retry
+    memcpy(&shared->header, header, sizeof(OverlayIPCHeader));
+    SDL_AddAtomicInt(&shared->header_seq, 1); // Even again: new generation
+    SDL_AddAtomicInt(&shared->publish_generation, 1);
+    return true;
+}
+
+bool ipc_read_header(SharedData *shared, OverlayIPCHeader *out, int *seq_out) {
+    for (int attempt = 0; attempt < IPC_HEADER_READ_RETRIES; attempt++) {
+        int before = SDL_GetAtomicInt(&shared->header_seq);
+        if (before == 0) return false; // Nothing published yet
+        if (before & 1) continue; // Writer is mid-copy
+        memcpy(out, &shared->header, sizeof(OverlayIPCHeader));
+        if (SDL_GetAtomicInt(&shared->header_seq) == before) {
+            if (seq_out) *seq_out = before;
+            return true;
+        }
+    }
+    return false;
+}
+
+// --------- TEMPLATE SEGMENTS ---------
+
+static size_t segment_slots_offset() {
+    return image_align(sizeof(IPCTemplateSegmentHeader));
+}
+
+static size_t slot_image_offset() {
+    return image_align(sizeof(IPCTemplateSlot));
+}
+
+static void segment_name(char *out, size_t out_size, int generation) {
+#ifdef _WIN32
+    snprintf(out, out_size, TEMPLATE_MEM_NAME_FORMAT, generation);
+#else
+    // POSIX shared memory names need a leading slash
+    snprintf(out, out_size, "/" TEMPLATE_MEM_NAME_FORMAT, generation);
+#endif
+}
+
+static void segment_reset(IPCTemplateSegment *seg) {
+    memset(seg, 0, sizeof(*seg));
+#ifndef _WIN32
+    seg->fd = -1;
+#endif
+}
+
+bool ipc_template_segment_create(IPCTemplateSegment *seg, int generation, size_t image_capacity) {
+    segment_reset(seg);
+    image_capacity = image_align(image_capacity);
+    size_t stride = slot_image_offset() + image_capacity;
+    size_t size = segment_slots_offset() + (size_t) IPC_TEMPLATE_SLOT_COUNT * stride;
+    char name[64];
+    segment_name(name, sizeof(name), generation);
+
+#ifdef _WIN32
+    HANDLE h_map = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD) ((uint64_t) size >> 32),
+                                      (DWORD) (size & 0xFFFFFFFFu), name);
+    if (h_map == nullptr) return false;
+    if (GetLastError() == ERROR_ALREADY_EXISTS) {
+        // Still held open by an overlay of an earlier session; its size is not ours to assume.
+        CloseHandle(h_map);
+        return false;
+    }
+    void *base = MapViewOfFile(h_map, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (base == nullptr) {
+        CloseHandle(h_map);
+        return false;
+    }
+    seg->h_map = h_map;
+#else
+    shm_unlink(name); // Left behind by a tracker that crashed
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0666);
+    if (fd == -1) return false;
+    if (ftruncate(fd, (off_t) size) == -1) {
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    seg->fd = fd;
+#endif
+
+    seg->generation = generation;
+    seg->size = size;
+    seg->base = (IPCTemplateSegmentHeader *) base;
+    seg->base->segment_size = size;
+    seg->base->slot_stride = stride;
+    seg->base->generation = generation;
+    for (int i = 0; i < IPC_TEMPLATE_SLOT_COUNT; i++) {
+        IPCTemplateSlot *slot = ipc_template_slot(seg, i);
+        slot->image_size = 0;
+        slot->image_capacity = image_capacity;
+        slot->body_generation = 0;
+        SDL_SetAtomicInt(&slot->delta_count, 0);
+    }
+    return true;
+}
+
+bool ipc_template_segment_open(IPCTemplateSegment *seg, int generation) {
+    segment_reset(seg);
+    char name[64];
+    segment_name(name, sizeof(name), generation);
+
+#ifdef _WIN32
+    HANDLE h_map = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+    if (h_map == nullptr) return false;
+    void *base = MapViewOfFile(h_map, FILE_MAP_ALL_ACCESS, 0, 0, 0); // Whole mapping
+    if (base == nullptr) {
+        CloseHandle(h_map);
+        return false;
+    }
+    MEMORY_BASIC_INFORMATION info;
+    size_t size = VirtualQuery(base, &info, sizeof(info)) ? info.RegionSize : 0;
+    seg->h_map = h_map;
+#else
+    // Read-write: the overlay relocates the template image in place (see IPCTemplateImage).
+    int fd = shm_open(name, O_RDWR, 0666);
+    if (fd == -1) return false;
+    struct stat st;
+    if (fstat(fd, &st) == -1 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t) st.st_size;
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    seg->fd = fd;
+#endif
+
+    seg->generation = generation;
+    seg->size = size;
+    seg->base = (IPCTemplateSegmentHeader *) base;
+    if (size < segment_slots_offset() || seg->base->generation != generation ||
+        seg->base->segment_size > size) {
+        ipc_template_segment_close(seg, false);
+        return false;
+    }
+    return true;
+}
+
+void ipc_template_segment_close(IPCTemplateSegment *seg, bool owner) {
+    if (!seg->base) return; // Nothing mapped (also covers a zero-initialized handle)
+#ifdef _WIN32
+    UnmapViewOfFile(seg->base);
+    CloseHandle((HANDLE) seg->h_map);
+    (void) owner; // The mapping goes away with its last handle
+#else
+    munmap(seg->base, seg->size);
+    close(seg->fd);
+    if (owner) {
+        char name[64];
+        segment_name(name, sizeof(name), seg->generation);
+        shm_unlink(name);
+    }
+#endif
+    segment_reset(seg);
+}
+
+IPCTemplateSlot *ipc_template_slot(const IPCTemplateSegment *seg, int slot) {
+    return (IPCTemplateSlot *) ((char *) seg->base + segment_slots_offset() +
+                                (size_t) slot * seg->base->slot_stride);
+}
+
+char *ipc_template_slot_image(IPCTemplateSlot *slot) {
+    return (char *) slot + slot_image_offset();
+}
+
+// --------- TEMPLATE TRIPLE BUFFER ---------
+
+IPCTemplateSlot *ipc_begin_template_write(SharedData *shared, const IPCTemplateSegment *seg) {
+    int latest = SDL_GetAtomicInt(&shared->latest_slot);
+    int pinned = SDL_GetAtomicInt(&shared->reader_slot);
+    for (int i = 0; i < IPC_TEMPLATE_SLOT_COUNT; i++) {
+        int ref = IPC_TEMPLATE_REF(seg->generation, i);
+        if (ref != latest && ref != pinned) {
+            // Deltas belong to the image they were appended to, so a reused slot starts with none.
+            IPCTemplateSlot *slot = ipc_template_slot(seg, i);
+            SDL_SetAtomicInt(&slot->delta_count, 0);
+            return slot;
+        }
+    }
+    return nullptr; // Unreachable with three slots
+}
+
+void ipc_commit_template_write(SharedData *shared, const IPCTemplateSegment *seg, IPCTemplateSlot *slot) {
+    int index = (int) (((char *) slot - (char *) ipc_template_slot(seg, 0)) / seg->base->slot_stride);
+    int generation = SDL_AddAtomicInt(&shared->body_generation, 1) + 1;
+    slot->body_generation = generation;
+    SDL_SetAtomicInt(&shared->latest_slot, IPC_TEMPLATE_REF(seg->generation, index));
+    SDL_AddAtomicInt(&shared->publish_generation, 1);
+}
+
+IPCTemplateSlot *ipc_pin_latest_template(SharedData *shared, IPCTemplateSegment *seg) {
+    int latest;
+    for (;;) {
+        latest = SDL_GetAtomicInt(&shared->latest_slot);
+        SDL_SetAtomicInt(&shared->reader_slot, latest);
+        if (latest < 0) return nullptr;
+        // The writer only avoids slots it sees pinned, so the pin counts only if the slot was still
+        // the latest after it became visible. Otherwise a newer image was published: pin that one.
+        if (SDL_GetAtomicInt(&shared->latest_slot) == latest) break;
+    }
+
+    int generation = IPC_TEMPLATE_REF_GENERATION(latest);
+    if (generation != seg->generation) {
+        // The tracker never writes an old segment again, so whatever was attached from the current
+        // mapping stays valid until the new one could be mapped.
+        IPCTemplateSegment next;
+        if (!ipc_template_segment_open(&next, generation)) return nullptr;
+        ipc_template_segment_close(seg, false);
+        *seg = next;
+    }
+    return ipc_template_slot(seg, IPC_TEMPLATE_REF_SLOT(latest));
+}
+
+// --------- PUBLISH WAKEUPS ---------
+
+bool ipc_wakeup_open(IPCWakeup *wakeup) {
+    memset(wakeup, 0, sizeof(*wakeup));
+#ifdef _WIN32
+    // Auto-reset: one wait consumes the signal, and a signal while nobody waits is kept for the next one
+    wakeup->h_event = CreateEventA(nullptr, FALSE, FALSE, OVERLAY_WAKEUP_EVENT_NAME);
+    return wakeup->h_event != nullptr;
+#else
+    return true;
+#endif
+}
+
+void ipc_wakeup_close(IPCWakeup *wakeup) {
+#ifdef _WIN32
+    if (wakeup->h_event) CloseHandle((HANDLE) wakeup->h_event);
+#endif
+    memset(wakeup, 0, sizeof(*wakeup));
+}
+
+void ipc_wakeup_signal(SharedData *shared, IPCWakeup *wakeup) {
+#ifdef _WIN32
+    (void) shared;
+    if (wakeup->h_event) SetEvent((HANDLE) wakeup->h_event);
+#elif defined(__linux__)
+    (void) wakeup;
+    // Not FUTEX_PRIVATE_FLAG: the waiter is another process mapping the same segment
+    syscall(SYS_futex, &shared->publish_generation.value, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#else
+    (void) shared;
+    (void) wakeup;
+#endif
+}
+
+void ipc_wakeup_wait(SharedData *shared, IPCWakeup *wakeup, int seen_generation, int timeout_ms) {
+    if (SDL_GetAtomicInt(&shared->publish_generation) != seen_generation) return;
+#ifdef _WIN32
+    if (wakeup->h_event) {
+        WaitForSingleObject((HANDLE) wakeup->h_event, (DWORD) timeout_ms);
+        return;
+    }
+    SDL_Delay((Uint32) (timeout_ms < IPC_WAKEUP_POLL_MS ? timeout_ms : IPC_WAKEUP_POLL_MS));
+#elif defined(__linux__)
+    (void) wakeup;
+    // Returns at once if the generation already moved on, so a publish between the check above and
+    // the wait is never slept through.
+    struct timespec ts;
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (long) (timeout_ms % 1000) * 1000000L;
+    syscall(SYS_futex, &shared->publish_generation.value, FUTEX_WAIT, seen_generation, &ts, nullptr, 0);
+#else
+    (void) wakeup;
+    SDL_Delay((Uint32) (timeout_ms < IPC_WAKEUP_POLL_MS ? timeout_ms : IPC_WAKEUP_POLL_MS));
+#endif
+}
+
+// --------- GOAL DELTAS ---------
+
+void ipc_capture_totals(const TemplateData *td, IPCTemplateTotals *out) {
+    memset(out, 0, sizeof(*out));
+    if (!td) return;
+    out->advancement_goal_count = td->advancement_goal_count;
+    out->advancements_completed_count = td->advancements_completed_count;
+    out->total_progress_steps = td->total_progress_steps;
+    out->overall_progress_percentage = td->overall_progress_percentage;
+    out->play_time_ticks = td->play_time_ticks;
+    out->frozen_play_time_ticks = td->frozen_play_time_ticks;
+    out->run_completed = td->run_completed;
+    out->speedrunigt_ms = td->speedrunigt_ms;
+}
+
+void ipc_apply_totals(TemplateData *td, const IPCTemplateTotals *totals) {
+    td->advancement_goal_count = totals->advancement_goal_count;
+    td->advancements_completed_count = totals->advancements_completed_count;
+    td->total_progress_steps = totals->total_progress_steps;
+    td->overall_progress_percentage = totals->overall_progress_percentage;
+    td->play_time_ticks = totals->play_time_ticks;
+    td->frozen_play_time_ticks = totals->frozen_play_time_ticks;
+    td->run_completed = totals->run_completed;
+    td->speedrunigt_ms = totals->speedrunigt_ms;
+}
+
+typedef void (*GoalVisitor)(IPCGoalKind kind, void *record, void *userdata);
+
+// The one goal walk both processes agree on. Changing the order breaks nothing as long as the tracker and
+// overlay run the same build, since both walk their own TemplateData.
+static void walk_goals(const TemplateData *td, GoalVisitor visit, void *userdata) {
+    for (int i = 0; i < td->advancement_count; i++) {
+        TrackableCategory *cat = td->advancements[i];
+        visit(IPC_GOAL_CATEGORY, cat, userdata);
+        for (int j = 0; j < cat->criteria_count; j++) visit(IPC_GOAL_ITEM, cat->criteria[j], userdata);
+    }
+    for (int i = 0; i < td->stat_count; i++) {
+        TrackableCategory *cat = td->stats[i];
+        visit(IPC_GOAL_CATEGORY, cat, userdata);
+        for (int j = 0; j < cat->criteria_count; j++) visit(IPC_GOAL_ITEM, cat->criteria[j], userdata);
+    }
+    for (int i = 0; i < td->multi_stage_goal_count; i++) {
+        MultiStageGoal *goal = td->multi_stage_goals[i];
+        visit(IPC_GOAL_MULTI_STAGE, goal, userdata);
+        for (int j = 0; j < goal->stage_count; j++) visit(IPC_GOAL_STAGE, goal->stages[j], userdata);
+    }
+    for (int i = 0; i < td->unlock_count; i++) visit(IPC_GOAL_ITEM, td->unlocks[i], userdata);
+    for (int i = 0; i < td->custom_goal_count; i++) visit(IPC_GOAL_ITEM, td->custom_goals[i], userdata);
+    for (int i = 0; i < td->counter_goal_count; i++) visit(IPC_GOAL_COUNTER, td->counter_goals[i], userdata);
+}
+
+static uint32_t face_hash_str(uint32_t h, const char *s) {
+    for (; *s; s++) {
+        h ^= (uint8_t) *s;
+        h *= 16777619u;
+    }
+    return h * 16777619u; // Separator, so "ab" + "" and "a" + "b" hash differently
+}
+
+// Everything dynamic about one goal, read straight from its record. Both the overlay deltas and the
+// progress state blob are built from this, so they can't disagree on what counts as progress.
+typedef struct {
+    uint32_t flags;
+    int progress;
+    int secondary;
+    int initial_progress;
+    const char *faces[IPC_GOAL_FACE_COUNT];
+} GoalRecord;
+
+static void read_goal(IPCGoalKind kind, const void *record, GoalRecord *out) {
+    memset(out, 0, sizeof(*out));
+    for (int f = 0; f < IPC_GOAL_FACE_COUNT; f++) out->faces[f] = "";
+    switch (kind) {
+        case IPC_GOAL_ITEM: {
+            const TrackableItem *item = (const TrackableItem *) record;
+            if (item->done) out->flags |= IPC_GOAL_FLAG_DONE;
+            if (item->is_manually_completed) out->flags |= IPC_GOAL_FLAG_MANUAL;
+            if (item->is_shared) out->flags |= IPC_GOAL_FLAG_SHARED;
+            out->progress = item->progress;
+            out->initial_progress = item->initial_progress;
+            out->faces[IPC_GOAL_FACE_CONTRIBUTOR] = item->highest_contributor_uuid;
+            out->faces[IPC_GOAL_FACE_MANUAL_COMPLETER] = item->manual_completer_uuid;
+            out->faces[IPC_GOAL_FACE_EXTRA] = item->custom_contributor_uuid;
+            break;
+        }
+        case IPC_GOAL_CATEGORY: {
+            const TrackableCategory *cat = (const TrackableCategory *) record;
+            if (cat->done) out->flags |= IPC_GOAL_FLAG_DONE;
+            if (cat->is_manually_completed) out->flags |= IPC_GOAL_FLAG_MANUAL;
+            if (cat->all_template_criteria_met) out->flags |= IPC_GOAL_FLAG_CRITERIA_MET;
+            if (cat->done_in_snapshot) out->flags |= IPC_GOAL_FLAG_DONE_IN_SNAPSHOT;
+            out->progress = cat->progress;
+            out->secondary = cat->completed_criteria_count;
+            out->faces[IPC_GOAL_FACE_CONTRIBUTOR] = cat->first_contributor_uuid;
+            out->faces[IPC_GOAL_FACE_MANUAL_COMPLETER] = cat->manual_completer_uuid;
+            out->faces[IPC_GOAL_FACE_EXTRA] = cat->assigned_owner_uuid;
+            break;
+        }
+        case IPC_GOAL_MULTI_STAGE:
+            out->progress = ((const MultiStageGoal *) record)->current_stage;
+            break;
+        case IPC_GOAL_STAGE: {
+            const SubGoal *stage = (const SubGoal *) record;
+            if (stage->coop_completed) out->flags |= IPC_GOAL_FLAG_COOP_DONE;
+            if (stage->game_trigger_met) out->flags |= IPC_GOAL_FLAG_TRIGGER_MET;
+            out->progress = stage->current_stat_progress;
+            break;
+        }
+        case IPC_GOAL_COUNTER: {
+            const CounterGoal *counter = (const CounterGoal *) record;
+            if (counter->done) out->flags |= IPC_GOAL_FLAG_DONE;
+            out->progress = counter->completed_count;
+            break;
+        }
+    }
+}
+
+static IPCGoalState goal_state(IPCGoalKind kind, const void *record) {
+    GoalRecord rec;
+    read_goal(kind, record, &rec);
+
+    IPCGoalState st;
+    st.flags = rec.flags;
+    st.progress = rec.progress;
+    st.secondary = rec.secondary;
+    uint32_t h = 2166136261u;
+    for (int f = 0; f < IPC_GOAL_FACE_COUNT; f++) h = face_hash_str(h, rec.faces[f]);
+    st.face_hash = h;
+    return st;
+}
+
+static void apply_goal_delta(const IPCGoalRef *ref, const IPCGoalDelta *d) {
+    switch (ref->kind) {
+        case IPC_GOAL_ITEM: {
+            TrackableItem *item = (TrackableItem *) ref->record;
+            item->done = (d->flags & IPC_GOAL_FLAG_DONE) != 0;
+            item->is_manually_completed = (d->flags & IPC_GOAL_FLAG_MANUAL) != 0;
+            item->is_shared = (d->flags & IPC_GOAL_FLAG_SHARED) != 0;
+            item->progress = d->progress;
+            break;
+        }
+        case IPC_GOAL_CATEGORY: {
+            TrackableCategory *cat = (TrackableCategory *) ref->record;
+            cat->done = (d->flags & IPC_GOAL_FLAG_DONE) != 0;
+            cat->is_manually_completed = (d->flags & IPC_GOAL_FLAG_MANUAL) != 0;
+            cat->all_template_criteria_met = (d->flags & IPC_GOAL_FLAG_CRITERIA_MET) != 0;
+            cat->done_in_snapshot = (d->flags & IPC_GOAL_FLAG_DONE_IN_SNAPSHOT) != 0;
+            cat->progress = d->progress;
+            cat->completed_criteria_count = d->secondary;
+            break;
+        }
+        case IPC_GOAL_MULTI_STAGE:
+            ((MultiStageGoal *) ref->record)->current_stage = d->progress;
+            break;
+        case IPC_GOAL_STAGE: {
+            SubGoal *stage = (SubGoal *) ref->record;
+            stage->coop_completed = (d->flags & IPC_GOAL_FLAG_COOP_DONE) != 0;
+            stage->game_trigger_met = (d->flags & IPC_GOAL_FLAG_TRIGGER_MET) != 0;
+            stage->current_stat_progress = d->progress;
+            break;
+        }
+        case IPC_GOAL_COUNTER: {
+            CounterGoal *counter = (CounterGoal *) ref->record;
+            counter->done = (d->flags & IPC_GOAL_FLAG_DONE) != 0;
+            counter->completed_count = d->progress;
+            break;
+        }
+    }
+}
+
+static void count_goal(IPCGoalKind, void *, void *userdata) {
+    (*(int *) userdata)++;
+}
+
+int ipc_count_goals(const TemplateData *td) {
+    int count = 0;
+    if (td) walk_goals(td, count_goal, &count);
+    return count;
+}
+
+typedef struct {
+    IPCGoalState *states;
+    int count;
+} StateCapture;
+
+static void capture_goal(IPCGoalKind kind, void *record, void *userdata) {
+    StateCapture *cap = (StateCapture *) userdata;
+    cap->states[cap->count++] = goal_state(kind, record);
+}
+
+void ipc_capture_goal_states(const TemplateData *td, IPCGoalState *out) {
+    if (!td) return;
+    StateCapture cap = {out, 0};
+    walk_goals(td, capture_goal, &cap);
+}
+
+typedef struct {
+    const IPCGoalState *published;
+    int published_count;
+    IPCGoalDelta *log; // The slot's delta array
+    int log_count; // Next free entry, starting at the published delta_count
+    int goal; // Position in the walk
+    bool failed;
+} DeltaDiff;
+
+static void diff_goal(IPCGoalKind kind, void *record, void *userdata) {
+    DeltaDiff *diff = (DeltaDiff *) userdata;
+    if (diff->failed) return;
+    int goal = diff->goal++;
+    if (goal >= diff->published_count) {
+        diff->failed = true;
+        return;
+    }
+
+    IPCGoalState now = goal_state(kind, record);
+    const IPCGoalState *was = &diff->published[goal];
+    if (now.face_hash != was->face_hash || diff->log_count >= IPC_GOAL_DELTA_CAPACITY) {
+        diff->failed = true;
+        return;
+    }
+    if (now.flags == was->flags && now.progress == was->progress && now.secondary == was->secondary) return;
+
+    // Written past the published count, so the overlay can't see it until the whole diff succeeded.
+    IPCGoalDelta *d = &diff->log[diff->log_count++];
+    d->goal = (uint32_t) goal;
+    d->flags = now.flags;
+    d->progress = now.progress;
+    d->secondary = now.secondary;
+}
+
+bool ipc_publish_goal_deltas(SharedData *shared, const IPCTemplateSegment *seg, const TemplateData *td,
+                             IPCGoalState *published, int published_count) {
+    if (!td || !published) return false;
+    int latest = SDL_GetAtomicInt(&shared->latest_slot);
+    if (latest < 0 || IPC_TEMPLATE_REF_GENERATION(latest) != seg->generation) return false;
+    IPCTemplateSlot *slot = ipc_template_slot(seg, IPC_TEMPLATE_REF_SLOT(latest));
+    if (slot->image_size == 0) return false;
+
+    int first = SDL_GetAtomicInt(&slot->delta_count);
+    DeltaDiff diff = {published, published_count, slot->deltas, first, 0, false};
+    walk_goals(td, diff_goal, &diff);
+    if (diff.failed || diff.goal != published_count) return false;
+    if (diff.log_count == first) return true; // Nothing changed
+
+    for (int i = first; i < diff.log_count; i++) {
+        const IPCGoalDelta *d = &slot->deltas[i];
+        published[d->goal].flags = d->flags;
+        published[d->goal].progress = d->progress;
+        published[d->goal].secondary = d->secondary;
+    }
+    SDL_SetAtomicInt(&slot->delta_count, diff.log_count);
+    SDL_AddAtomicInt(&shared->publish_generation, 1);
+    return true;
+}
+
+typedef struct {
+    IPCGoalRef *refs;
+    int count;
+} RefIndex;
+
+static void index_goal(IPCGoalKind kind, void *record, void *userdata) {
+    RefIndex *index = (RefIndex *) userdata;
+    index->refs[index->count].kind = kind;
+    index->refs[index->count].record = record;
+    index->count++;
+}
+
+void ipc_index_goals(TemplateData *td, IPCGoalRef *out) {
+    if (!td) return;
+    RefIndex index = {out, 0};
+    walk_goals(td, index_goal, &index);
+}
+
+void ipc_apply_goal_deltas(IPCTemplateSlot *slot, const IPCGoalRef *refs, int ref_count, int *applied) {
+    int count = SDL_GetAtomicInt(&slot->delta_count);
+    if (count > IPC_GOAL_DELTA_CAPACITY) count = IPC_GOAL_DELTA_CAPACITY;
+    for (int i = *applied; i < count; i++) {
+        const IPCGoalDelta *d = &slot->deltas[i];
+        if (d->goal < (uint32_t) ref_count) apply_goal_delta(&refs[d->goal], d);
+    }
+    if (count > *applied) *applied = count;
+}
+
+// --------- PROGRESS STATE BLOB ---------
+
+typedef struct {
+    uint8_t *kinds;
+    uint8_t *flags;
+    IPCProgressValue *values;
+    IPCProgressFace *faces;
+    char (*uuids)[IPC_PROGRESS_UUID_LEN];
+    uint32_t goal_count;
+    uint32_t value_count;
+    uint32_t face_count;
+    uint32_t uuid_count;
+    uint32_t uuid_capacity;
+    bool counting; // First pass: only count values and faces
+} ProgressWriter;
+
+static bool progress_values_empty(const GoalRecord *rec) {
+    return rec->progress == 0 && rec->secondary == 0 && rec->initial_progress == 0;
+}
+
+static uint16_t progress_intern_uuid(ProgressWriter *w, const char *uuid) {
+    for (uint32_t i = 0; i < w->uuid_count; i++) {
+        if (strncmp(w->uuids[i], uuid, IPC_PROGRESS_UUID_LEN) == 0) return (uint16_t) i;
+    }
+    char *slot = w->uuids[w->uuid_count];
+    strncpy(slot, uuid, IPC_PROGRESS_UUID_LEN - 1);
+    slot[IPC_PROGRESS_UUID_LEN - 1] = '\0';
+    return (uint16_t) w->uuid_count++;
+}
+
+static void progress_write_goal(IPCGoalKind kind, void *record, void *userdata) {
+    ProgressWriter *w = (ProgressWriter *) userdata;
+    GoalRecord rec;
+    read_goal(kind, record, &rec);
+    uint32_t goal = w->goal_count++;
+
+    if (!w->counting) {
+        w->kinds[goal] = (uint8_t) kind;
+        w->flags[goal] = (uint8_t) rec.flags;
+    }
+    if (!progress_values_empty(&rec)) {
+        if (!w->counting) {
+            IPCProgressValue *v = &w->values[w->value_count];
+            v->goal = goal;
+            v->progress = rec.progress;
+            v->secondary = rec.secondary;
+            v->initial_progress = rec.initial_progress;
+        }
+        w->value_count++;
+    }
+    for (int f = 0; f < IPC_GOAL_FACE_COUNT; f++) {
+        if (rec.faces[f][0] == '\0') continue;
+        if (!w->counting) {
+            IPCProgressFace *face = &w->faces[w->face_count];
+            face->goal = goal;
+            face->face = (uint16_t) f;
+            face->uuid = progress_intern_uuid(w, rec.faces[f]);
+        }
+        w->face_count++;
+    }
+}
+
+size_t ipc_write_progress_state(const TemplateData *td, char *dst, size_t capacity) {
+    if (!td || !dst) return 0;
+
+    // 1. Count, so every section's position is known up front.
+    ProgressWriter w;
+    memset(&w, 0, sizeof(w));
+    w.counting = true;
+    walk_goals(td, progress_write_goal, &w);
+    uint32_t goal_count = w.goal_count, value_count = w.value_count, face_count = w.face_count;
+
+    // 2. Lay out: header, the sparse values and faces, the UUID table (at most one entry per face), then
+    // the dense per-goal bytes. Every section before the bytes is a multiple of 4 bytes long.
+    size_t values_offset = sizeof(IPCProgressStateHeader);
+    size_t faces_offset = values_offset + (size_t) value_count * sizeof(IPCProgressValue);
+    size_t uuids_offset = faces_offset + (size_t) face_count * sizeof(IPCProgressFace);
+    size_t max_uuids_end = uuids_offset + (size_t) face_count * IPC_PROGRESS_UUID_LEN;
+    if (max_uuids_end + 2 * (size_t) goal_count > capacity) return 0;
+
+    memset(&w, 0, sizeof(w));
+    w.values = (IPCProgressValue *) (dst + values_offset);
+    w.faces = (IPCProgressFace *) (dst + faces_offset);
+    w.uuids = (char (*)[IPC_PROGRESS_UUID_LEN]) (dst + uuids_offset);
+    // The per-goal bytes are placed after the UUID table once its size is known, so they're written
+    // to the end of the worst-case area first and moved down afterwards.
+    w.kinds = (uint8_t *) (dst + max_uuids_end);
+    w.flags = w.kinds + goal_count;
+    walk_goals(td, progress_write_goal, &w);
+
+    size_t bytes_offset = uuids_offset + (size_t) w.uuid_count * IPC_PROGRESS_UUID_LEN;
+    if (bytes_offset != max_uuids_end) memmove(dst + bytes_offset, dst + max_uuids_end, 2 * (size_t) goal_count);
+
+    // 3. Header with the section counts and the template-wide totals.
+    IPCProgressStateHeader *hdr = (IPCProgressStateHeader *) dst;
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->magic = IPC_PROGRESS_STATE_MAGIC;
+    hdr->blob_size = (uint32_t) (bytes_offset + 2 * (size_t) goal_count);
+    hdr->goal_count = goal_count;
+    hdr->value_count = value_count;
+    hdr->face_count = face_count;
+    hdr->uuid_count = w.uuid_count;
+    hdr->advancement_count = td->advancement_count;
+    hdr->stat_count = td->stat_count;
+    hdr->multi_stage_goal_count = td->multi_stage_goal_count;
+    hdr->unlock_count = td->unlock_count;
+    hdr->custom_goal_count = td->custom_goal_count;
+    hdr->counter_goal_count = td->counter_goal_count;
+    hdr->advancements_completed_count = td->advancements_completed_count;
+    hdr->stats_completed_count = td->stats_completed_count;
+    hdr->stats_completed_criteria_count = td->stats_completed_criteria_count;
+    hdr->unlocks_completed_count = td->unlocks_completed_count;
+    hdr->completed_criteria_count = td->completed_criteria_count;
+    hdr->total_progress_steps = td->total_progress_steps;
+    hdr->advancement_goal_count = td->advancement_goal_count;
+    hdr->overall_progress_percentage = td->overall_progress_percentage;
+    hdr->host_time_since_last_update = td->host_time_since_last_update;
+    hdr->play_time_ticks = td->play_time_ticks;
+    hdr->frozen_play_time_ticks = td->frozen_play_time_ticks;
+    hdr->speedrunigt_ms = td->speedrunigt_ms;
+    hdr->run_completed = td->run_completed;
+    return hdr->blob_size;
+}
+
+bool ipc_progress_state_valid(const char *blob, size_t size) {
+    if (!blob || size < sizeof(IPCProgressStateHeader)) return false;
+    const IPCProgressStateHeader *hdr = (const IPCProgressStateHeader *) blob;
+    if (hdr->magic != IPC_PROGRESS_STATE_MAGIC || hdr->blob_size > size) return false;
+    size_t need = sizeof(IPCProgressStateHeader) + (size_t) hdr->value_count * sizeof(IPCProgressValue) +
+                  (size_t) hdr->face_count * sizeof(IPCProgressFace) +
+                  (size_t) hdr->uuid_count * IPC_PROGRESS_UUID_LEN + 2 * (size_t) hdr->goal_count;
+    if (need != hdr->blob_size) return false;
+
+    // The reader hands out UUIDs as C strings, so each one must end inside its slot.
+    const char *uuids = blob + sizeof(IPCProgressStateHeader) + (size_t) hdr->value_count * sizeof(IPCProgressValue) +
+                        (size_t) hdr->face_count * sizeof(IPCProgressFace);
+    for (uint32_t i = 0; i < hdr->uuid_count; i++) {
+        if (!memchr(uuids + (size_t) i * IPC_PROGRESS_UUID_LEN, '\0', IPC_PROGRESS_UUID_LEN)) return false;
+    }
+    return true;
+}
+
+bool ipc_progress_open(const char *blob, IPCProgressReader *r) {
+    memset(r, 0, sizeof(*r));
+    if (!blob) return false;
+    const IPCProgressStateHeader *hdr = (const IPCProgressStateHeader *) blob;
+    // Blobs are checked against their received size where they enter the process (see
+    // ipc_progress_state_valid), so the declared size is trusted here.
+    if (!ipc_progress_state_valid(blob, hdr->blob_size)) return false;
+
+    r->header = hdr;
+    r->values = (const IPCProgressValue *) (blob + sizeof(IPCProgressStateHeader));
+    r->faces = (const IPCProgressFace *) (r->values + hdr->value_count);
+    r->uuids = (const char (*)[IPC_PROGRESS_UUID_LEN]) (r->faces + hdr->face_count);
+    r->kinds = (const uint8_t *) (r->uuids + hdr->uuid_count);
+    r->flags = r->kinds + hdr->goal_count;
+    return true;
+}
+
+bool ipc_progress_next(IPCProgressReader *r, IPCGoalKind kind, IPCProgressGoal *out) {
+    if (!r->header || r->goal >= r->header->goal_count) return false;
+    uint32_t goal = r->goal;
+    if (r->kinds[goal] != (uint8_t) kind) return false;
+    r->goal++;
+
+    memset(out, 0, sizeof(*out));
+    for (int f = 0; f < IPC_GOAL_FACE_COUNT; f++) out->faces[f] = "";
+    out->flags = r->flags[goal];
+
+    // Values and faces are sorted by goal, so one cursor each walks along with the goals.
+    while (r->value_pos < r->header->value_count && r->values[r->value_pos].goal < goal) r->value_pos++;
+    if (r->value_pos < r->header->value_count && r->values[r->value_pos].goal == goal) {
+        const IPCProgressValue *v = &r->values[r->value_pos++];
+        out->progress = v->progress;
+        out->secondary = v->secondary;
+        out->initial_progress = v->initial_progress;
+    }
+    while (r->face_pos < r->header->face_count && r->faces[r->face_pos].goal <= goal) {
+        const IPCProgressFace *face = &r->faces[r->face_pos++];
+        if (face->goal == goal && face->face < IPC_GOAL_FACE_COUNT && face->uuid < r->header->uuid_count) {
+            out->faces[face->face] = r->uuids[face->uuid];
+        }
+    }
+    return true;
+}
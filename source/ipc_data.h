@@ -16,6 +16,7 @@
 
 #include "data_structures.h" // For TemplateData
 #include "main.h" // For MAX_PATH_LENGTH
+#include "coop_net.h" // For COOP_MAX_LOBBY
 
 // These names are the "keys" that allow the two separate processes
 // to find the same shared memory block and mutex
@@ -29,17 +30,489 @@
 // mutex, Linux/macOS an flock'd file next to settings.json; both are released by the OS when the
 // overlay process dies, so a crashed overlay never leaves a stale guard behind.
 #define OVERLAY_INSTANCE_MUTEX_NAME "AdvancelyOverlayInstanceMutex"
+#define OVERLAY_WAKEUP_EVENT_NAME "AdvancelyOverlayWakeupEvent" // Windows only, see PUBLISH WAKEUPS
 
-// Define a large, fixed-size buffer for our serialized data.
-// 64MB should be more than enough for any template.
-#define SHARED_BUFFER_SIZE (64 * 1024 * 1024)
+// The template images live in a second segment, sized from the template and re-created under a new
+// name (with the generation appended) when a template reload needs more room. The small control
+// segment above (SharedData) stays mapped for the whole session and says which generation is current.
+#define TEMPLATE_MEM_NAME_FORMAT "AdvancelyTemplateMemory_%d"
 
-// The new struct holds the size of the data and the data itself as a raw byte buffer.
+// Smallest image capacity per slot, so small template edits don't re-create the segment every time.
+#define IPC_TEMPLATE_MIN_CAPACITY (256 * 1024)
+
+// Number of template image slots. Three lets the tracker always find one that is neither the latest
+// published image nor the one the overlay is reading, so neither side ever waits for the other.
+#define IPC_TEMPLATE_SLOT_COUNT 3
+
+// latest_slot/reader_slot name a slot together with the template segment generation it lives in.
+#define IPC_TEMPLATE_REF(generation, slot) (((generation) << 2) | (slot))
+#define IPC_TEMPLATE_REF_GENERATION(ref) ((ref) >> 2)
+#define IPC_TEMPLATE_REF_SLOT(ref) ((ref) & 3)
+
+// Template-wide totals the overlay shows (progress bar, IGT, run-complete state). They change on
+// almost every update, so they travel in the header and are applied onto the attached template.
 typedef struct {
-    size_t data_size;
-    bool shutdown_requested; // To gracefully close the overlay process and finish its log file
-    char buffer[SHARED_BUFFER_SIZE];
+    int advancement_goal_count;
+    int advancements_completed_count;
+    int total_progress_steps;
+    float overall_progress_percentage;
+    long long play_time_ticks;
+    long long frozen_play_time_ticks;
+    bool run_completed;
+    long long speedrunigt_ms;
+} IPCTemplateTotals;
+
+// The live values the overlay needs besides the template itself. Rewritten by the tracker every
+// frame (the update timer ticks), so it's published through a seqlock instead of a template slot.
+typedef struct {
+    char world_name[MAX_PATH_LENGTH];
+    float time_since_last_update;
+    // Top-bar labels the overlay used to read from its own settings copy (needed a
+    // restart to refresh). Sent live here so template/version/category changes update
+    // the overlay without restarting it. Sizes mirror the AppSettings fields.
+    char version_str[64];
+    char display_version_str[64];
+    char category_display_name[MAX_PATH_LENGTH];
+    // Co-op view state, pushed live so Compact mode can show contributor faces without a
+    // restart (the overlay process has no g_coop_ctx of its own). coop_lobby_active mirrors
+    // coop_net_get_state() != IDLE; coop_all_players_view is the merged view (no specific
+    // player/ghost selected). coop_selected_uuid + coop_selected_offline pin one player's
+    // face when a specific view is chosen. The roster lets the overlay resolve each stack
+    // face's account type (offline -> Notch) exactly like the tracker does.
+    bool coop_lobby_active;
+    bool coop_all_players_view;
+    char coop_selected_uuid[48];
+    bool coop_selected_offline;
+    int coop_lobby_count;
+
+    struct {
+        char uuid[48];
+        bool is_offline;
+    } coop_lobby[COOP_MAX_LOBBY];
+
+    IPCTemplateTotals totals;
+} OverlayIPCHeader;
+
+// --------- GOAL DELTAS ---------
+// Between full template publishes the tracker only ships the goals whose progress changed. Goals are
+// addressed by their position in a fixed walk over the template (advancements and stats each followed
+// by their criteria, multi-stage goals followed by their stages, unlocks, custom goals, counters), which
+// the tracker and the overlay both compute from their own TemplateData.
+
+// Maximum deltas appended to one template slot before the tracker falls back to a full publish.
+#define IPC_GOAL_DELTA_CAPACITY 4096
+
+enum IPCGoalKind {
+    IPC_GOAL_ITEM = 0, // TrackableItem: criteria, sub-stats, unlocks, custom goals
+    IPC_GOAL_CATEGORY, // TrackableCategory: advancements and stats
+    IPC_GOAL_MULTI_STAGE, // MultiStageGoal
+    IPC_GOAL_STAGE, // SubGoal of a multi-stage goal
+    IPC_GOAL_COUNTER // CounterGoal
+};
+
+// IPCGoalState::flags
+#define IPC_GOAL_FLAG_DONE (1u << 0)
+#define IPC_GOAL_FLAG_MANUAL (1u << 1) // is_manually_completed
+#define IPC_GOAL_FLAG_SHARED (1u << 2) // TrackableItem::is_shared
+#define IPC_GOAL_FLAG_CRITERIA_MET (1u << 3) // TrackableCategory::all_template_criteria_met
+#define IPC_GOAL_FLAG_COOP_DONE (1u << 4) // SubGoal::coop_completed
+#define IPC_GOAL_FLAG_TRIGGER_MET (1u << 5) // SubGoal::game_trigger_met
+#define IPC_GOAL_FLAG_DONE_IN_SNAPSHOT (1u << 6) // TrackableCategory::done_in_snapshot
+
+// The co-op contributor UUIDs a goal can carry. Items: highest_contributor_uuid, manual_completer_uuid,
+// custom_contributor_uuid. Categories: first_contributor_uuid, manual_completer_uuid, assigned_owner_uuid.
+enum IPCGoalFace {
+    IPC_GOAL_FACE_CONTRIBUTOR = 0,
+    IPC_GOAL_FACE_MANUAL_COMPLETER,
+    IPC_GOAL_FACE_EXTRA,
+    IPC_GOAL_FACE_COUNT
+};
+
+// The compact, render-relevant progress of one goal. What progress/secondary hold depends on the kind:
+// item progress, category progress + completed_criteria_count, multi-stage current_stage, stage
+// current_stat_progress, counter completed_count.
+typedef struct {
+    uint32_t flags;
+    int progress;
+    int secondary;
+    // Hash of the co-op contributor UUIDs. They change too rarely to be worth a delta, so a
+    // change here makes the tracker publish the full template instead.
+    uint32_t face_hash;
+} IPCGoalState;
+
+typedef struct {
+    uint32_t goal; // Position in the goal walk
+    uint32_t flags;
+    int progress;
+    int secondary;
+} IPCGoalDelta;
+
+// A goal record of an attached template, resolved once per attach so deltas apply without a walk.
+typedef struct {
+    IPCGoalKind kind;
+    void *record;
+} IPCGoalRef;
+
+// One template image slot. Only ever written while it is neither published nor pinned by the reader.
+// Goal deltas are appended to the latest slot only: entries below delta_count are never rewritten until the
+// slot is reused for a new image, so the overlay can apply them while the tracker appends more.
+// The image itself follows the slot record (see ipc_template_slot_image).
+typedef struct {
+    size_t image_size; // Bytes of the template image in this slot (0 = no template loaded)
+    size_t image_capacity; // Bytes available for the image
+    int body_generation; // Publish generation of the image, set before the slot is published
+    SDL_AtomicInt delta_count; // Published entries in deltas[]
+    IPCGoalDelta deltas[IPC_GOAL_DELTA_CAPACITY];
+} IPCTemplateSlot;
+
+// Start of a template segment, followed by IPC_TEMPLATE_SLOT_COUNT slots of slot_stride bytes each.
+typedef struct {
+    size_t segment_size;
+    size_t slot_stride;
+    int generation;
+} IPCTemplateSegmentHeader;
+
+// This process's mapping of one template segment.
+typedef struct {
+    int generation; // 0 = nothing mapped
+    size_t size;
+    IPCTemplateSegmentHeader *base;
+#ifdef _WIN32
+    void *h_map; // HANDLE of the file mapping
+#else
+    int fd;
+#endif
+} IPCTemplateSegment;
+
+// Everything in the shared segment is exchanged without a lock: the header through a seqlock and the
+// template through the slots of the template segment. The named mutex is still created by the tracker,
+// but only as the marker the overlay opens to tell whether a tracker is running.
+typedef struct {
+    SDL_AtomicInt shutdown_requested; // To gracefully close the overlay process and finish its log file
+
+    // Bumped on every publish (header or template body), so the overlay can tell a fresh publish
+    // from the same bytes it consumed last frame.
+    SDL_AtomicInt publish_generation;
+
+    // Header seqlock: odd while the tracker is rewriting the header. A stable even value doubles as
+    // the header generation.
+    SDL_AtomicInt header_seq;
+    OverlayIPCHeader header;
+
+    // Template triple buffer, as IPC_TEMPLATE_REF values. latest_slot is -1 until the first publish;
+    // reader_slot is the slot the overlay is reading in place (-1 for none) and is never chosen by the
+    // writer. The generation in latest_slot also tells the overlay which template segment to map.
+    SDL_AtomicInt latest_slot;
+    SDL_AtomicInt reader_slot;
+    SDL_AtomicInt body_generation; // Generation of the latest published image
 } SharedData;
 
+/**
+ * @brief Resets the publish state of a freshly created segment (no header, no template published).
+ */
+void ipc_shared_init(SharedData *shared);
+
+/**
+ * @brief Publishes a new header through the seqlock. Only the tracker writes the header.
+ * @return true if the header changed and was published, false if it was identical to the current one.
+ */
+bool ipc_publish_header(SharedData *shared, const OverlayIPCHeader *header);
+
+/**
+ * @brief Copies a consistent header out of the seqlock.
+ * @param out Receives the header.
+ * @param seq_out Receives the header generation that was read.
+ * @return false if no header was published yet or the tracker kept rewriting it during every retry.
+ */
+bool ipc_read_header(SharedData *shared, OverlayIPCHeader *out, int *seq_out);
+
+/**
+ * @brief Creates and maps a template segment with room for images of image_capacity bytes per slot.
+ * A leftover segment of the same name (from a crashed tracker) is replaced.
+ * @return false if the segment couldn't be created or mapped; seg is left unmapped then.
+ */
+bool ipc_template_segment_create(IPCTemplateSegment *seg, int generation, size_t image_capacity);
+
+/**
+ * @brief Maps the template segment of the given generation created by the tracker.
+ * @return false if it doesn't exist (anymore) or couldn't be mapped; seg is left unmapped then.
+ */
+bool ipc_template_segment_open(IPCTemplateSegment *seg, int generation);
+
+/**
+ * @brief Unmaps a template segment. The creator passes owner = true so the name goes away as well; a
+ * process that still has it mapped keeps its mapping until it closes it too.
+ */
+void ipc_template_segment_close(IPCTemplateSegment *seg, bool owner);
+
+/**
+ * @brief The slot record at index slot of a mapped template segment.
+ */
+IPCTemplateSlot *ipc_template_slot(const IPCTemplateSegment *seg, int slot);
+
+/**
+ * @brief The image bytes of a slot (IPCTemplateSlot::image_capacity of them).
+ */
+char *ipc_template_slot_image(IPCTemplateSlot *slot);
+
+/**
+ * @brief Picks a template slot of the tracker's current segment it may write: never the latest published
+ * one and never the one pinned by the overlay. Always succeeds with IPC_TEMPLATE_SLOT_COUNT >= 3.
+ */
+IPCTemplateSlot *ipc_begin_template_write(SharedData *shared, const IPCTemplateSegment *seg);
+
+/**
+ * @brief Publishes a slot filled after ipc_begin_template_write() as the latest template image.
+ */
+void ipc_commit_template_write(SharedData *shared, const IPCTemplateSegment *seg, IPCTemplateSlot *slot);
+
+/**
+ * @brief Pins the latest published slot for reading, first mapping its template segment into seg if the
+ * tracker moved to a new one. The pin protects the slot from the writer until the next call, so the
+ * overlay can walk the image in place for a whole frame.
+ * @return The pinned slot, or nullptr if nothing was published yet or the new segment isn't available yet
+ * (the tracker re-created it again in the meantime; the next call retries).
+ */
+IPCTemplateSlot *ipc_pin_latest_template(SharedData *shared, IPCTemplateSegment *seg);
+
+// --------- PUBLISH WAKEUPS ---------
+// Lets the overlay sleep until the tracker publishes instead of polling the shared segment every frame.
+// Linux waits on a futex on SharedData::publish_generation itself, Windows on a named auto-reset event.
+// Other platforms have no cross-process wait on shared memory, so their wait falls back to a short poll.
+
+// Upper bound of one wait on platforms without a real wakeup, in milliseconds.
+#define IPC_WAKEUP_POLL_MS 10
+
+// This process's handle to the wakeup. Nothing to open on Linux, the futex lives in the shared segment.
+typedef struct {
+#ifdef _WIN32
+    void *h_event; // HANDLE of the named event
+#else
+    int unused;
+#endif
+} IPCWakeup;
+
+/**
+ * @brief Opens the wakeup, creating it if the other side hasn't yet. Both processes call this.
+ * @return false if it couldn't be opened; waits then simply time out and signals do nothing.
+ */
+bool ipc_wakeup_open(IPCWakeup *wakeup);
+
+void ipc_wakeup_close(IPCWakeup *wakeup);
+
+/**
+ * @brief Wakes an overlay waiting in ipc_wakeup_wait(). Called by the tracker after anything it published
+ * (publish_generation moved) and after requesting a shutdown.
+ */
+void ipc_wakeup_signal(SharedData *shared, IPCWakeup *wakeup);
+
+/**
+ * @brief Blocks until the tracker signals, publish_generation is no longer seen_generation, or timeout_ms
+ * passed. May return early (spurious wakeups); callers re-check the shared state afterwards.
+ */
+void ipc_wakeup_wait(SharedData *shared, IPCWakeup *wakeup, int seen_generation, int timeout_ms);
+
+/**
+ * @brief Copies the template-wide totals the overlay shows into the header format.
+ */
+void ipc_capture_totals(const TemplateData *td, IPCTemplateTotals *out);
+
+/**
+ * @brief Writes header totals onto an attached template.
+ */
+void ipc_apply_totals(TemplateData *td, const IPCTemplateTotals *totals);
+
+/**
+ * @brief Number of goals in the goal walk of a template (see GOAL DELTAS).
+ */
+int ipc_count_goals(const TemplateData *td);
+
+/**
+ * @brief Captures the state of every goal in walk order.
+ * @param out Receives ipc_count_goals(td) states.
+ */
+void ipc_capture_goal_states(const TemplateData *td, IPCGoalState *out);
+
+/**
+ * @brief Appends a delta for every goal whose state differs from the last published one to the latest
+ * template slot and updates the published states to match.
+ * @param published The states of the last publish, updated in place. Unchanged if this fails.
+ * @param published_count Number of entries in published.
+ * @return false if the template can't be expressed as deltas (goal count or contributor faces changed, no
+ * image published yet, or the slot's delta log is full), in which case the caller publishes the full template.
+ */
+bool ipc_publish_goal_deltas(SharedData *shared, const IPCTemplateSegment *seg, const TemplateData *td,
+                             IPCGoalState *published, int published_count);
+
+/**
+ * @brief Resolves the goal walk of an attached template into refs.
+ * @param out Receives ipc_count_goals(td) refs.
+ */
+void ipc_index_goals(TemplateData *td, IPCGoalRef *out);
+
+/**
+ * @brief Applies the deltas of a pinned slot that weren't applied yet onto its attached template.
+ * @param applied In: deltas already applied. Out: deltas applied after this call.
+ */
+void ipc_apply_goal_deltas(IPCTemplateSlot *slot, const IPCGoalRef *refs, int ref_count, int *applied);
+
+// --------- RELOCATABLE TEMPLATE IMAGE ---------
+// The template data in each IPCTemplateSlot is written as a relocatable image instead of a stream of
+// structs: every TemplateData/TrackableCategory/... record sits in a fixed-stride array per section,
+// and every pointer field or pointer-array slot holds an offset from the image start. A relocation table lists where those pointer words are, so the overlay
+// turns the image into a walkable TemplateData in place with one pass of additions and reads it
+// straight out of the shared segment - no per-frame calloc/memcpy/free of the whole template.
+
+#define IPC_TEMPLATE_IMAGE_MAGIC 0x41445649u // "ADVI"
+
+typedef struct {
+    uint32_t magic; // IPC_TEMPLATE_IMAGE_MAGIC once a complete image has been written
+    uint32_t reloc_count; // Number of entries in the relocation table
+    size_t image_size; // Total bytes of the image, this header included
+    size_t template_offset; // Offset of the TemplateData record from the image start
+    size_t reloc_offset; // Offset of the relocation table (size_t offsets of pointer words)
+    // Base address the pointer words are currently relative to. The tracker writes 0 (plain offsets);
+    // the overlay stores its own image address after relocating, so an unchanged image is never
+    // patched twice and a restarted overlay (new mapping address) re-bases it by the difference.
+    uintptr_t relocated_base;
+} IPCTemplateImage;
+
+/**
+ * @brief Bytes ipc_write_template_image() needs for a TemplateData.
+ */
+size_t ipc_template_image_size(const TemplateData *td);
+
+/**
+ * @brief Writes a TemplateData as a relocatable image (see IPCTemplateImage).
+ * Tracker-only pointers (textures, linked goals of items/categories/stages, decorations) are
+ * written as null, counter goals keep their linked goals because the overlay shows their count.
+ *
+ * @param td The template data to write.
+ * @param dst Destination buffer, usually the image of a template slot (see ipc_template_slot_image).
+ * @param capacity Number of bytes available at dst.
+ * @return The image size in bytes, or 0 if td is null or the image doesn't fit.
+ */
+size_t ipc_write_template_image(const TemplateData *td, char *dst, size_t capacity);
+
+/**
+ * @brief Relocates an image in place (if it isn't already relative to this address) and returns
+ * the TemplateData inside it. The returned pointers all point into the image, so they are only
+ * valid while its slot stays pinned (see ipc_pin_latest_template).
+ *
+ * @param image Start of the image in this process's mapping (must be writable).
+ * @param available Number of readable bytes at image, to reject a truncated or corrupt image.
+ * @return The TemplateData inside the image, or nullptr if the image is invalid.
+ */
+TemplateData *ipc_attach_template_image(char *image, size_t available);
+
+
+// --------- PROGRESS STATE BLOB ---------
+// The co-op snapshot format (STATE_UPDATE, PLAYER_STATES and the host's cached per-player snapshots).
+// Only dynamic state goes over the wire: names, icons, keys and layout are known to both sides from the
+// template itself (the overlay gets them once per template load as the image above, co-op receivers
+// through the template sync). Goals are addressed by the same walk as the goal deltas:
+//
+//   IPCProgressStateHeader  counts and template-wide totals
+//   IPCProgressValue[]      progress/secondary/initial_progress, only for goals where one isn't 0
+//   IPCProgressFace[]       contributor faces, only the non-empty ones
+//   char[48][]              UUID table the faces index into, each UUID stored once
+//   uint8_t[goal_count]     IPCGoalKind per goal, so a template mismatch is caught instead of misapplied
+//   uint8_t[goal_count]     IPC_GOAL_FLAG_* per goal
+//
+// A template with thousands of goals and little progress fits in a few KB.
+
+#define IPC_PROGRESS_STATE_MAGIC 0x41445653u // "ADVS"
+#define IPC_PROGRESS_UUID_LEN 48
+
+typedef struct {
+    uint32_t magic;
+    uint32_t blob_size;
+    uint32_t goal_count;
+    uint32_t value_count;
+    uint32_t face_count;
+    uint32_t uuid_count;
+
+    // Section counts, checked against the receiver's template before anything is applied
+    int advancement_count;
+    int stat_count;
+    int multi_stage_goal_count;
+    int unlock_count;
+    int custom_goal_count;
+    int counter_goal_count;
+
+    // Template-wide totals
+    int advancements_completed_count;
+    int stats_completed_count;
+    int stats_completed_criteria_count;
+    int unlocks_completed_count;
+    int completed_criteria_count;
+    int total_progress_steps;
+    int advancement_goal_count;
+    float overall_progress_percentage;
+    float host_time_since_last_update;
+    long long play_time_ticks;
+    long long frozen_play_time_ticks;
+    long long speedrunigt_ms;
+    bool run_completed;
+} IPCProgressStateHeader;
+
+typedef struct {
+    uint32_t goal;
+    int progress;
+    int secondary;
+    int initial_progress;
+} IPCProgressValue;
+
+typedef struct {
+    uint32_t goal;
+    uint16_t face; // IPCGoalFace
+    uint16_t uuid; // Index into the UUID table
+} IPCProgressFace;
+
+// One goal as read back from a blob. Faces are "" when empty.
+typedef struct {
+    uint32_t flags;
+    int progress;
+    int secondary;
+    int initial_progress;
+    const char *faces[IPC_GOAL_FACE_COUNT];
+} IPCProgressGoal;
+
+typedef struct {
+    const IPCProgressStateHeader *header;
+    const IPCProgressValue *values;
+    const IPCProgressFace *faces;
+    const char (*uuids)[IPC_PROGRESS_UUID_LEN];
+    const uint8_t *kinds;
+    const uint8_t *flags;
+    uint32_t goal; // Next goal to read
+    uint32_t value_pos;
+    uint32_t face_pos;
+} IPCProgressReader;
+
+/**
+ * @brief Writes the dynamic state of a template as a progress state blob.
+ * @return Bytes written, or 0 if td is null or the blob doesn't fit into capacity.
+ */
+size_t ipc_write_progress_state(const TemplateData *td, char *dst, size_t capacity);
+
+/**
+ * @brief Checks a blob received from elsewhere: magic, section sizes and UUID termination.
+ * @param size The number of bytes actually available at blob.
+ */
+bool ipc_progress_state_valid(const char *blob, size_t size);
+
+/**
+ * @brief Opens a blob for reading its goals in walk order. The blob must have passed
+ * ipc_progress_state_valid() where it was received.
+ */
+bool ipc_progress_open(const char *blob, IPCProgressReader *r);
+
+/**
+ * @brief Reads the next goal.
+ * @param kind The kind of the goal the receiver's template has at this position.
+ * @return false if the blob has no more goals or its goal here is of another kind (template mismatch).
+ */
+bool ipc_progress_next(IPCProgressReader *r, IPCGoalKind kind, IPCProgressGoal *out);
 
 #endif //IPC_DATA_H
@@ -139,34 +139,6 @@ static bool show_support_milestone_window = false; // For the one-time launch-mi
 static char release_url_buffer[256] = {0};
 static SDL_Texture *g_logo_texture = nullptr; // Loading the advancely logo
 
-// Define the header structure globally so it can be used in both the full update and the continuous update blocks
-typedef struct {
-    char world_name[MAX_PATH_LENGTH];
-    float time_since_last_update;
-    // Top-bar labels the overlay used to read from its own settings copy (needed a
-    // restart to refresh). Sent live here so template/version/category changes update
-    // the overlay without restarting it. Sizes mirror the AppSettings fields.
-    char version_str[64];
-    char display_version_str[64];
-    char category_display_name[MAX_PATH_LENGTH];
-    // Co-op view state, pushed live so Compact mode can show contributor faces without a
-    // restart (the overlay process has no g_coop_ctx of its own). coop_lobby_active mirrors
-    // coop_net_get_state() != IDLE; coop_all_players_view is the merged view (no specific
-    // player/ghost selected). coop_selected_uuid + coop_selected_offline pin one player's
-    // face when a specific view is chosen. The roster lets the overlay resolve each stack
-    // face's account type (offline -> Notch) exactly like the tracker does.
-    bool coop_lobby_active;
-    bool coop_all_players_view;
-    char coop_selected_uuid[48];
-    bool coop_selected_offline;
-    int coop_lobby_count;
-
-    struct {
-        char uuid[48];
-        bool is_offline;
-    } coop_lobby[COOP_MAX_LOBBY];
-} OverlayIPCHeader;
-
 // Fill the version/category labels the overlay shows in its top bar. Sent live in the
 // IPC header (alongside world_name/time) so a template/version/category change updates
 // the overlay without restarting it. Call at every site that writes the header.
@@ -231,6 +203,161 @@ static void fill_overlay_coop_state(OverlayIPCHeader *header, const Tracker *t,
 }
 
 
+// Fills the whole IPC header: world name (or the co-op sync label on receivers), the update timer,
+// the top-bar labels and the co-op view state. Used by every site that writes the header.
+static void fill_overlay_ipc_header(OverlayIPCHeader *header, const Tracker *t, const AppSettings *settings) {
+    if (!tracker_build_coop_sync_label(t, settings, header->world_name, MAX_PATH_LENGTH)) {
+        strncpy(header->world_name, t->world_name, MAX_PATH_LENGTH - 1);
+        header->world_name[MAX_PATH_LENGTH - 1] = '\0';
+    }
+    // The overlay shows this in 5 second steps. Publishing it at that resolution leaves the header
+    // unchanged in between, so the continuous header refresh doesn't wake an idle overlay every frame.
+    header->time_since_last_update = floorf(t->time_since_last_update / 5.0f) * 5.0f;
+    fill_overlay_ipc_labels(header, settings);
+    fill_overlay_coop_state(header, t, settings);
+    ipc_capture_totals(t->template_data, &header->totals);
+}
+
+// Publishes the IPC header through its seqlock (see SharedData). Skipped when the bytes match what the
+// overlay already has, so an unchanged header doesn't count as a new publish.
+static void write_overlay_ipc_header(Tracker *t, const AppSettings *settings) {
+    OverlayIPCHeader header;
+    memset(&header, 0, sizeof(header)); // Deterministic padding/tails so the compare in ipc_publish_header is meaningful
+    fill_overlay_ipc_header(&header, t, settings);
+    if (ipc_publish_header(t->p_shared_data, &header)) ipc_wakeup_signal(t->p_shared_data, &t->ipc_wakeup);
+}
+
+// Makes sure the template segment has room for an image of image_size bytes, moving to a new, larger
+// segment (next generation) if it doesn't. The old one is dropped right away: an overlay still reading it
+// keeps its own mapping until it has mapped the new one.
+static bool ensure_ipc_template_segment(Tracker *t, size_t image_size) {
+    IPCTemplateSegment *seg = &t->ipc_template_segment;
+    if (seg->base && image_size <= ipc_template_slot(seg, 0)->image_capacity) return true;
+
+    // Headroom, so growing a template a few goals at a time doesn't re-create the segment every time
+    size_t capacity = image_size + image_size / 2;
+    if (capacity < IPC_TEMPLATE_MIN_CAPACITY) capacity = IPC_TEMPLATE_MIN_CAPACITY;
+
+    int generation = t->ipc_template_generation;
+    ipc_template_segment_close(seg, true);
+    // A name can still be held by an overlay of an earlier session (Windows), so try a few generations
+    for (int attempt = 0; attempt < 8; attempt++) {
+        generation++;
+        if (ipc_template_segment_create(seg, generation, capacity)) {
+            t->ipc_template_generation = generation;
+            log_message(LOG_INFO, "[IPC] Template shared memory sized to %zu KB per slot (generation %d).\n",
+                        capacity / 1024, generation);
+            return true;
+        }
+    }
+    t->ipc_template_generation = generation;
+    log_message(LOG_ERROR, "[IPC] Failed to create the template shared memory (%zu KB), overlay not updated.\n",
+                capacity / 1024);
+    return false;
+}
+
+// Publishes the header and the template. When the goal layout is unchanged since the last publish,
+// only the goals whose progress changed are appended as deltas to the published image (see GOAL
+// DELTAS in ipc_data.h). Otherwise a fresh relocatable template image (see IPCTemplateImage) goes into
+// a slot the overlay isn't reading, so this never waits for the overlay.
+static void write_overlay_ipc_payload(Tracker *t, const AppSettings *settings) {
+    write_overlay_ipc_header(t, settings);
+
+    int generation = SDL_GetAtomicInt(&t->p_shared_data->publish_generation);
+    if (!t->ipc_full_publish_pending &&
+        ipc_publish_goal_deltas(t->p_shared_data, &t->ipc_template_segment, t->template_data, t->ipc_goal_states,
+                                t->ipc_goal_state_count)) {
+        if (SDL_GetAtomicInt(&t->p_shared_data->publish_generation) != generation) {
+            ipc_wakeup_signal(t->p_shared_data, &t->ipc_wakeup);
+        }
+        return;
+    }
+
+    if (!ensure_ipc_template_segment(t, ipc_template_image_size(t->template_data))) return;
+    IPCTemplateSlot *slot = ipc_begin_template_write(t->p_shared_data, &t->ipc_template_segment);
+    if (!slot) return;
+    slot->image_size = ipc_write_template_image(t->template_data, ipc_template_slot_image(slot),
+                                                slot->image_capacity);
+    ipc_commit_template_write(t->p_shared_data, &t->ipc_template_segment, slot);
+    ipc_wakeup_signal(t->p_shared_data, &t->ipc_wakeup);
+
+    // Remember what was just published so the next publishes can be diffed against it
+    int goal_count = ipc_count_goals(t->template_data);
+    if (goal_count > t->ipc_goal_state_count || !t->ipc_goal_states) {
+        IPCGoalState *states = (IPCGoalState *) realloc(t->ipc_goal_states,
+                                                        (size_t) (goal_count > 0 ? goal_count : 1) * sizeof(IPCGoalState));
+        if (!states) {
+            // Without a baseline every publish stays a full one
+            free(t->ipc_goal_states);
+            t->ipc_goal_states = nullptr;
+            t->ipc_goal_state_count = 0;
+            return;
+        }
+        t->ipc_goal_states = states;
+    }
+    ipc_capture_goal_states(t->template_data, t->ipc_goal_states);
+    t->ipc_goal_state_count = goal_count;
+    t->ipc_full_publish_pending = false;
+}
+
+// Longest the overlay sleeps with nothing due, so the Windows tracker-crash check (abandoned mutex)
+// still runs about once a second while the overlay idles.
+#define OVERLAY_IDLE_WAKE_MS 1000
+
+// Timeout of one wait of the wake watcher, so it notices a stop request without a signal too.
+#define OVERLAY_WAKE_WATCH_TIMEOUT_MS 500
+
+// Overlay side of the publish wakeups: a thread blocked on the tracker's signal that turns every new
+// publish (or shutdown request) into an SDL event, so the overlay loop can sleep in SDL_WaitEventTimeout
+// and still wake for new data as well as for input and window events.
+typedef struct {
+    SharedData *shared;
+    IPCWakeup *wakeup;
+    Uint32 event_type;
+    SDL_AtomicInt stop;
+    SDL_Thread *thread;
+} OverlayWakeWatch;
+
+static int SDLCALL overlay_wake_watch_thread(void *data) {
+    OverlayWakeWatch *w = (OverlayWakeWatch *) data;
+    int seen = SDL_GetAtomicInt(&w->shared->publish_generation);
+    while (!SDL_GetAtomicInt(&w->stop)) {
+        ipc_wakeup_wait(w->shared, w->wakeup, seen, OVERLAY_WAKE_WATCH_TIMEOUT_MS);
+        int generation = SDL_GetAtomicInt(&w->shared->publish_generation);
+        if (generation == seen && !SDL_GetAtomicInt(&w->shared->shutdown_requested)) continue;
+        seen = generation;
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = w->event_type;
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+
+static void overlay_wake_watch_start(OverlayWakeWatch *w, SharedData *shared, IPCWakeup *wakeup) {
+    memset(w, 0, sizeof(*w));
+    w->shared = shared;
+    w->wakeup = wakeup;
+    w->event_type = SDL_RegisterEvents(1);
+    if (w->event_type == 0) {
+        log_message(LOG_ERROR, "[OVERLAY IPC] Could not register an SDL event type for publish wakeups.\n");
+        return;
+    }
+    w->thread = SDL_CreateThread(overlay_wake_watch_thread, "AdvancelyOverlayWake", w);
+    if (!w->thread) {
+        log_message(LOG_ERROR, "[OVERLAY IPC] Failed to start the wakeup thread: %s\n", SDL_GetError());
+    }
+}
+
+static void overlay_wake_watch_stop(OverlayWakeWatch *w) {
+    if (!w->thread) return;
+    SDL_SetAtomicInt(&w->stop, 1);
+    ipc_wakeup_signal(w->shared, w->wakeup); // Cut its current wait short
+    SDL_WaitThread(w->thread, nullptr);
+    w->thread = nullptr;
+}
+
+
 // All builds now have the resources folder on the same level as the executable or .app bundle
 static void find_and_set_resource_path(char *path_buffer, size_t buffer_size) {
     // For all builds (Windows, macOS, Linux and windows), find the executable's path.
@@ -279,271 +406,122 @@ static void find_and_set_resource_path(char *path_buffer, size_t buffer_size) {
 
 
 /**
- * @brief Serializes the TemplateData into a flat byte buffer.
- * This "flattens" the complex data structure so it can be sent to another process.
+ * @brief Serializes the progress of the TemplateData into a flat byte buffer.
+ * Only the dynamic state is written, as a progress state blob (see ipc_data.h), since the receiver
+ * already has the template itself. Used for co-op broadcasts, per-player snapshots and Hermes workbufs.
+ * @return Bytes written, 0 if the state doesn't fit into capacity.
  */
-size_t serialize_template_data(TemplateData *td, char *buffer) {
-    if (!td || !buffer) return 0;
-
-    char *head = buffer;
-
-    // 1. Copy the main TemplateData struct.
-    memcpy(head, td, sizeof(TemplateData));
-    head += sizeof(TemplateData);
-
-    // 2. Copy advancements and their criteria.
-    for (int i = 0; i < td->advancement_count; i++) {
-        memcpy(head, td->advancements[i], sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-        for (int j = 0; j < td->advancements[i]->criteria_count; j++) {
-            memcpy(head, td->advancements[i]->criteria[j], sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-        }
-    }
-
-    // 3. Copy stats and their criteria.
-    for (int i = 0; i < td->stat_count; i++) {
-        memcpy(head, td->stats[i], sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-        for (int j = 0; j < td->stats[i]->criteria_count; j++) {
-            memcpy(head, td->stats[i]->criteria[j], sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-        }
-    }
-
-    // 4. Copy multi-stage goals and their stages.
-    for (int i = 0; i < td->multi_stage_goal_count; i++) {
-        memcpy(head, td->multi_stage_goals[i], sizeof(MultiStageGoal));
-        head += sizeof(MultiStageGoal);
-        for (int j = 0; j < td->multi_stage_goals[i]->stage_count; j++) {
-            memcpy(head, td->multi_stage_goals[i]->stages[j], sizeof(SubGoal));
-            head += sizeof(SubGoal);
-        }
-    }
-
-    // 5. Copy unlocks.
-    for (int i = 0; i < td->unlock_count; i++) {
-        memcpy(head, td->unlocks[i], sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
-    }
-
-    // 6. Copy custom goals.
-    for (int i = 0; i < td->custom_goal_count; i++) {
-        memcpy(head, td->custom_goals[i], sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
-    }
-
-    // 7. Copy counter goals and their linked goals.
-    for (int i = 0; i < td->counter_goal_count; i++) {
-        memcpy(head, td->counter_goals[i], sizeof(CounterGoal));
-        head += sizeof(CounterGoal);
-        for (int j = 0; j < td->counter_goals[i]->linked_goal_count; j++) {
-            memcpy(head, &td->counter_goals[i]->linked_goals[j], sizeof(CounterLinkedGoal));
-            head += sizeof(CounterLinkedGoal);
-        }
-    }
-
-    return head - buffer; // Return the total size of the serialized data.
+size_t serialize_template_data(TemplateData *td, char *buffer, size_t capacity) {
+    return ipc_write_progress_state(td, buffer, capacity);
 }
 
-
-/**
- * @brief Deserializes a flat byte buffer back into a valid TemplateData structure.
- * This "rebuilds" the data in the overlay's memory space with new, valid pointers.
- */
-static void deserialize_template_data(char *buffer, TemplateData *target_td) {
-    if (!buffer || !target_td) return;
-
-    char *head = buffer;
-
-    // 1. Read the main TemplateData struct to get the counts.
-    memcpy(target_td, head, sizeof(TemplateData));
-    head += sizeof(TemplateData);
-
-    // 2. Allocate memory for all the pointer arrays in the overlay's address space.
-    target_td->advancements = (TrackableCategory **) calloc(target_td->advancement_count, sizeof(TrackableCategory *));
-    target_td->stats = (TrackableCategory **) calloc(target_td->stat_count, sizeof(TrackableCategory *));
-    target_td->multi_stage_goals = (MultiStageGoal **) calloc(target_td->multi_stage_goal_count,
-                                                              sizeof(MultiStageGoal *));
-    target_td->unlocks = (TrackableItem **) calloc(target_td->unlock_count, sizeof(TrackableItem *));
-    target_td->custom_goals = (TrackableItem **) calloc(target_td->custom_goal_count, sizeof(TrackableItem *));
-    target_td->counter_goals = (CounterGoal **) calloc(target_td->counter_goal_count, sizeof(CounterGoal *));
-
-    // Decorations aren't serialized to the overlay; the memcpy above carried over the tracker's
-    // dangling pointer and count, so clear them here to make a stray dereference impossible.
-    target_td->decorations = nullptr;
-    target_td->decoration_count = 0;
-
-    // 3. Read advancements and their criteria.
-    for (int i = 0; i < target_td->advancement_count; i++) {
-        target_td->advancements[i] = (TrackableCategory *) calloc(1, sizeof(TrackableCategory));
-        memcpy(target_td->advancements[i], head, sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-        // linked_goals aren't serialized; drop the dangling tracker pointer/count carried by the memcpy.
-        target_td->advancements[i]->linked_goals = nullptr;
-        target_td->advancements[i]->linked_goal_count = 0;
-        target_td->advancements[i]->criteria = (TrackableItem **) calloc(
-            target_td->advancements[i]->criteria_count, sizeof(TrackableItem *));
-        for (int j = 0; j < target_td->advancements[i]->criteria_count; j++) {
-            target_td->advancements[i]->criteria[j] = (TrackableItem *) calloc(1, sizeof(TrackableItem));
-            memcpy(target_td->advancements[i]->criteria[j], head, sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-        }
-    }
-
-    // 4. Read stats and their criteria.
-    for (int i = 0; i < target_td->stat_count; i++) {
-        target_td->stats[i] = (TrackableCategory *) calloc(1, sizeof(TrackableCategory));
-        memcpy(target_td->stats[i], head, sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-        // linked_goals aren't serialized; drop the dangling tracker pointer/count carried by the memcpy.
-        target_td->stats[i]->linked_goals = nullptr;
-        target_td->stats[i]->linked_goal_count = 0;
-        target_td->stats[i]->criteria = (TrackableItem **) calloc(target_td->stats[i]->criteria_count,
-                                                                  sizeof(TrackableItem *));
-        for (int j = 0; j < target_td->stats[i]->criteria_count; j++) {
-            target_td->stats[i]->criteria[j] = (TrackableItem *) calloc(1, sizeof(TrackableItem));
-            memcpy(target_td->stats[i]->criteria[j], head, sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-        }
-    }
-
-    // 5. Read multi-stage goals and their stages.
-    for (int i = 0; i < target_td->multi_stage_goal_count; i++) {
-        target_td->multi_stage_goals[i] = (MultiStageGoal *) calloc(1, sizeof(MultiStageGoal));
-        memcpy(target_td->multi_stage_goals[i], head, sizeof(MultiStageGoal));
-        head += sizeof(MultiStageGoal);
-        target_td->multi_stage_goals[i]->stages = (SubGoal **) calloc(target_td->multi_stage_goals[i]->stage_count,
-                                                                      sizeof(SubGoal *));
-        for (int j = 0; j < target_td->multi_stage_goals[i]->stage_count; j++) {
-            target_td->multi_stage_goals[i]->stages[j] = (SubGoal *) calloc(1, sizeof(SubGoal));
-            memcpy(target_td->multi_stage_goals[i]->stages[j], head, sizeof(SubGoal));
-            head += sizeof(SubGoal);
-            // linked_goals aren't serialized; drop the dangling tracker pointer/count carried by the memcpy.
-            target_td->multi_stage_goals[i]->stages[j]->linked_goals = nullptr;
-            target_td->multi_stage_goals[i]->stages[j]->linked_goal_count = 0;
-        }
+// Copies a snapshot serialize_template_data() just wrote into work. Returns nullptr when nothing was
+// written (the state didn't fit), so callers keep their last valid snapshot instead of an empty one.
+static char *coop_snapshot_copy(const char *work, size_t size, const char *what) {
+    if (size == 0) {
+        log_message(LOG_ERROR, "[COOP] %s snapshot doesn't fit the serialize buffer, keeping the previous one.\n",
+                    what);
+        return nullptr;
     }
+    char *buf = (char *) malloc(size);
+    if (buf) memcpy(buf, work, size);
+    return buf;
+}
 
-    // 6. Read unlocks.
-    for (int i = 0; i < target_td->unlock_count; i++) {
-        target_td->unlocks[i] = (TrackableItem *) calloc(1, sizeof(TrackableItem));
-        memcpy(target_td->unlocks[i], head, sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
-    }
 
-    // 7. Read custom goals.
-    for (int i = 0; i < target_td->custom_goal_count; i++) {
-        target_td->custom_goals[i] = (TrackableItem *) calloc(1, sizeof(TrackableItem));
-        memcpy(target_td->custom_goals[i], head, sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
-    }
-
-    // 8. Read counter goals and their linked goals.
-    for (int i = 0; i < target_td->counter_goal_count; i++) {
-        target_td->counter_goals[i] = (CounterGoal *) calloc(1, sizeof(CounterGoal));
-        memcpy(target_td->counter_goals[i], head, sizeof(CounterGoal));
-        head += sizeof(CounterGoal);
-        target_td->counter_goals[i]->linked_goals = (CounterLinkedGoal *) calloc(
-            target_td->counter_goals[i]->linked_goal_count, sizeof(CounterLinkedGoal));
-        for (int j = 0; j < target_td->counter_goals[i]->linked_goal_count; j++) {
-            memcpy(&target_td->counter_goals[i]->linked_goals[j], head, sizeof(CounterLinkedGoal));
-            head += sizeof(CounterLinkedGoal);
-        }
-    }
+// Copies one contributor UUID from a snapshot into a goal's fixed-size field.
+static void merge_coop_face(char *dst_uuid, size_t dst_size, const char *src_uuid) {
+    strncpy(dst_uuid, src_uuid, dst_size - 1);
+    dst_uuid[dst_size - 1] = '\0';
 }
 
-
 // Merges progress-only state from a serialize_template_data() buffer into an existing,
-// already-loaded TemplateData. Unlike deserialize_template_data(), this preserves every
+// already-loaded TemplateData. This only touches the dynamic fields and preserves every
 // pointer field (textures, criteria arrays, etc.) in the target, so it's safe to call
 // inside the tracker process - the receiver merges host state without clobbering its
-// own loaded resources. Returns true on success, false if counts don't match (indicating
-// the receiver hasn't finished reloading to the host's template yet).
+// own loaded resources. Buffers from the network must have passed ipc_progress_state_valid().
+// Returns true on success, false if the layout doesn't match (indicating the receiver
+// hasn't finished reloading to the host's template yet).
 bool merge_coop_progress(const char *buffer, TemplateData *target) {
     if (!buffer || !target) return false;
-    const char *head = buffer;
-
-    TemplateData incoming;
-    memcpy(&incoming, head, sizeof(TemplateData));
-    head += sizeof(TemplateData);
-
-    if (incoming.advancement_count != target->advancement_count ||
-        incoming.stat_count != target->stat_count ||
-        incoming.multi_stage_goal_count != target->multi_stage_goal_count ||
-        incoming.unlock_count != target->unlock_count ||
-        incoming.custom_goal_count != target->custom_goal_count ||
-        incoming.counter_goal_count != target->counter_goal_count) {
+
+    IPCProgressReader r;
+    if (!ipc_progress_open(buffer, &r)) {
+        log_message(LOG_ERROR, "[COOP] Merge skipped: not a valid progress state snapshot.\n");
+        return false;
+    }
+    const IPCProgressStateHeader *incoming = r.header;
+
+    if (incoming->advancement_count != target->advancement_count ||
+        incoming->stat_count != target->stat_count ||
+        incoming->multi_stage_goal_count != target->multi_stage_goal_count ||
+        incoming->unlock_count != target->unlock_count ||
+        incoming->custom_goal_count != target->custom_goal_count ||
+        incoming->counter_goal_count != target->counter_goal_count ||
+        (int) incoming->goal_count != ipc_count_goals(target)) {
         log_message(LOG_ERROR,
                     "[COOP] Merge skipped: template count mismatch with host "
                     "(host adv=%d stat=%d msg=%d unl=%d cg=%d cnt=%d, "
                     "receiver adv=%d stat=%d msg=%d unl=%d cg=%d cnt=%d). "
                     "Waiting for template sync to reload.\n",
-                    incoming.advancement_count, incoming.stat_count, incoming.multi_stage_goal_count,
-                    incoming.unlock_count, incoming.custom_goal_count, incoming.counter_goal_count,
+                    incoming->advancement_count, incoming->stat_count, incoming->multi_stage_goal_count,
+                    incoming->unlock_count, incoming->custom_goal_count, incoming->counter_goal_count,
                     target->advancement_count, target->stat_count, target->multi_stage_goal_count,
                     target->unlock_count, target->custom_goal_count, target->counter_goal_count);
         return false;
     }
 
-    target->advancements_completed_count = incoming.advancements_completed_count;
-    target->stats_completed_count = incoming.stats_completed_count;
-    target->stats_completed_criteria_count = incoming.stats_completed_criteria_count;
-    target->unlocks_completed_count = incoming.unlocks_completed_count;
-    target->completed_criteria_count = incoming.completed_criteria_count;
-    target->overall_progress_percentage = incoming.overall_progress_percentage;
-    target->total_progress_steps = incoming.total_progress_steps;
-    target->advancement_goal_count = incoming.advancement_goal_count;
-    target->play_time_ticks = incoming.play_time_ticks;
-    target->frozen_play_time_ticks = incoming.frozen_play_time_ticks;
-    target->speedrunigt_ms = incoming.speedrunigt_ms;
-    target->run_completed = incoming.run_completed;
-    target->host_time_since_last_update = incoming.host_time_since_last_update;
+    target->advancements_completed_count = incoming->advancements_completed_count;
+    target->stats_completed_count = incoming->stats_completed_count;
+    target->stats_completed_criteria_count = incoming->stats_completed_criteria_count;
+    target->unlocks_completed_count = incoming->unlocks_completed_count;
+    target->completed_criteria_count = incoming->completed_criteria_count;
+    target->overall_progress_percentage = incoming->overall_progress_percentage;
+    target->total_progress_steps = incoming->total_progress_steps;
+    target->advancement_goal_count = incoming->advancement_goal_count;
+    target->play_time_ticks = incoming->play_time_ticks;
+    target->frozen_play_time_ticks = incoming->frozen_play_time_ticks;
+    target->speedrunigt_ms = incoming->speedrunigt_ms;
+    target->run_completed = incoming->run_completed;
+    target->host_time_since_last_update = incoming->host_time_since_last_update;
+
+    IPCProgressGoal in;
 
     for (int i = 0; i < target->advancement_count; i++) {
-        TrackableCategory in_cat;
-        memcpy(&in_cat, head, sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-
         TrackableCategory *dst = target->advancements[i];
-        if (!dst || dst->criteria_count != in_cat.criteria_count) {
+        if (!ipc_progress_next(&r, IPC_GOAL_CATEGORY, &in)) {
             log_message(LOG_ERROR, "[COOP] Merge skipped: criteria count mismatch for advancement %d.\n", i);
             return false;
         }
-        dst->done = in_cat.done;
-        dst->is_manually_completed = in_cat.is_manually_completed;
-        dst->all_template_criteria_met = in_cat.all_template_criteria_met;
-        dst->done_in_snapshot = in_cat.done_in_snapshot;
-        dst->progress = in_cat.progress;
-        dst->completed_criteria_count = in_cat.completed_criteria_count;
-        memcpy(dst->first_contributor_uuid, in_cat.first_contributor_uuid,
-               sizeof(dst->first_contributor_uuid));
+        dst->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+        dst->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
+        dst->all_template_criteria_met = (in.flags & IPC_GOAL_FLAG_CRITERIA_MET) != 0;
+        dst->done_in_snapshot = (in.flags & IPC_GOAL_FLAG_DONE_IN_SNAPSHOT) != 0;
+        dst->progress = in.progress;
+        dst->completed_criteria_count = in.secondary;
+        merge_coop_face(dst->first_contributor_uuid, sizeof(dst->first_contributor_uuid),
+                        in.faces[IPC_GOAL_FACE_CONTRIBUTOR]);
         // Carry the per-advancement coop owner so the live-Hermes merge keeps
         // scoping an assigned complex advancement to its owner between game saves
         // (otherwise it regresses to "most criteria wins" until the next disk merge).
-        memcpy(dst->assigned_owner_uuid, in_cat.assigned_owner_uuid,
-               sizeof(dst->assigned_owner_uuid));
-
-        for (int j = 0; j < in_cat.criteria_count; j++) {
-            TrackableItem in_item;
-            memcpy(&in_item, head, sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-            TrackableItem *dst_item = dst->criteria ? dst->criteria[j] : nullptr;
-            if (!dst_item) continue;
-            dst_item->done = in_item.done;
-            dst_item->progress = in_item.progress;
-            dst_item->initial_progress = in_item.initial_progress;
-            dst_item->is_manually_completed = in_item.is_manually_completed;
+        merge_coop_face(dst->assigned_owner_uuid, sizeof(dst->assigned_owner_uuid), in.faces[IPC_GOAL_FACE_EXTRA]);
+
+        for (int j = 0; j < dst->criteria_count; j++) {
+            if (!ipc_progress_next(&r, IPC_GOAL_ITEM, &in)) {
+                log_message(LOG_ERROR, "[COOP] Merge skipped: criteria count mismatch for advancement %d.\n", i);
+                return false;
+            }
+            TrackableItem *dst_item = dst->criteria[j];
+            dst_item->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+            dst_item->progress = in.progress;
+            dst_item->initial_progress = in.initial_progress;
+            dst_item->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
         }
     }
 
     for (int i = 0; i < target->stat_count; i++) {
-        TrackableCategory in_cat;
-        memcpy(&in_cat, head, sizeof(TrackableCategory));
-        head += sizeof(TrackableCategory);
-
         TrackableCategory *dst = target->stats[i];
-        if (!dst || dst->criteria_count != in_cat.criteria_count) {
+        if (!ipc_progress_next(&r, IPC_GOAL_CATEGORY, &in)) {
             log_message(LOG_ERROR, "[COOP] Merge skipped: criteria count mismatch for stat %d.\n", i);
             return false;
         }
@@ -552,188 +530,95 @@ bool merge_coop_progress(const char *buffer, TemplateData *target) {
         // revert the user's click before the host's echo arrives.
         bool skip_top = tracker_pending_mod_should_skip("", dst->root_name);
         if (!skip_top) {
-            dst->done = in_cat.done;
-            dst->is_manually_completed = in_cat.is_manually_completed;
-            dst->all_template_criteria_met = in_cat.all_template_criteria_met;
-            dst->done_in_snapshot = in_cat.done_in_snapshot;
-            dst->progress = in_cat.progress;
-            dst->completed_criteria_count = in_cat.completed_criteria_count;
-            memcpy(dst->manual_completer_uuid, in_cat.manual_completer_uuid,
-                   sizeof(dst->manual_completer_uuid));
+            dst->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+            dst->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
+            dst->all_template_criteria_met = (in.flags & IPC_GOAL_FLAG_CRITERIA_MET) != 0;
+            dst->done_in_snapshot = (in.flags & IPC_GOAL_FLAG_DONE_IN_SNAPSHOT) != 0;
+            dst->progress = in.progress;
+            dst->completed_criteria_count = in.secondary;
+            merge_coop_face(dst->manual_completer_uuid, sizeof(dst->manual_completer_uuid),
+                            in.faces[IPC_GOAL_FACE_MANUAL_COMPLETER]);
         }
 
-        for (int j = 0; j < in_cat.criteria_count; j++) {
-            TrackableItem in_item;
-            memcpy(&in_item, head, sizeof(TrackableItem));
-            head += sizeof(TrackableItem);
-            TrackableItem *dst_item = dst->criteria ? dst->criteria[j] : nullptr;
-            if (!dst_item) continue;
+        for (int j = 0; j < dst->criteria_count; j++) {
+            if (!ipc_progress_next(&r, IPC_GOAL_ITEM, &in)) {
+                log_message(LOG_ERROR, "[COOP] Merge skipped: criteria count mismatch for stat %d.\n", i);
+                return false;
+            }
+            TrackableItem *dst_item = dst->criteria[j];
             // Skip per-criterion if a pending mod targets it under this stat.
             if (tracker_pending_mod_should_skip(dst->root_name, dst_item->root_name)) continue;
-            dst_item->done = in_item.done;
-            dst_item->progress = in_item.progress;
-            dst_item->initial_progress = in_item.initial_progress;
-            dst_item->is_manually_completed = in_item.is_manually_completed;
-            memcpy(dst_item->highest_contributor_uuid, in_item.highest_contributor_uuid,
-                   sizeof(dst_item->highest_contributor_uuid));
-            memcpy(dst_item->manual_completer_uuid, in_item.manual_completer_uuid,
-                   sizeof(dst_item->manual_completer_uuid));
+            dst_item->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+            dst_item->progress = in.progress;
+            dst_item->initial_progress = in.initial_progress;
+            dst_item->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
+            merge_coop_face(dst_item->highest_contributor_uuid, sizeof(dst_item->highest_contributor_uuid),
+                            in.faces[IPC_GOAL_FACE_CONTRIBUTOR]);
+            merge_coop_face(dst_item->manual_completer_uuid, sizeof(dst_item->manual_completer_uuid),
+                            in.faces[IPC_GOAL_FACE_MANUAL_COMPLETER]);
         }
     }
 
     for (int i = 0; i < target->multi_stage_goal_count; i++) {
-        MultiStageGoal in_msg;
-        memcpy(&in_msg, head, sizeof(MultiStageGoal));
-        head += sizeof(MultiStageGoal);
-
         MultiStageGoal *dst = target->multi_stage_goals[i];
-        if (!dst || dst->stage_count != in_msg.stage_count) {
+        if (!ipc_progress_next(&r, IPC_GOAL_MULTI_STAGE, &in)) {
             log_message(LOG_ERROR, "[COOP] Merge skipped: stage count mismatch for multi-stage goal %d.\n", i);
             return false;
         }
-        dst->current_stage = in_msg.current_stage;
-
-        for (int j = 0; j < in_msg.stage_count; j++) {
-            SubGoal in_stage;
-            memcpy(&in_stage, head, sizeof(SubGoal));
-            head += sizeof(SubGoal);
-            SubGoal *dst_stage = dst->stages ? dst->stages[j] : nullptr;
-            if (!dst_stage) continue;
-            dst_stage->current_stat_progress = in_stage.current_stat_progress;
+        dst->current_stage = in.progress;
+
+        for (int j = 0; j < dst->stage_count; j++) {
+            if (!ipc_progress_next(&r, IPC_GOAL_STAGE, &in)) {
+                log_message(LOG_ERROR, "[COOP] Merge skipped: stage count mismatch for multi-stage goal %d.\n", i);
+                return false;
+            }
+            SubGoal *dst_stage = dst->stages[j];
+            dst_stage->current_stat_progress = in.progress;
             // Carry the stage's game-trigger state so a following recalculation re-derives the same
             // current_stage (the recompute reads game_trigger_met for non-stat stages) instead of regressing.
-            dst_stage->coop_completed = in_stage.coop_completed;
-            dst_stage->game_trigger_met = in_stage.game_trigger_met;
+            dst_stage->coop_completed = (in.flags & IPC_GOAL_FLAG_COOP_DONE) != 0;
+            dst_stage->game_trigger_met = (in.flags & IPC_GOAL_FLAG_TRIGGER_MET) != 0;
         }
     }
 
     for (int i = 0; i < target->unlock_count; i++) {
-        TrackableItem in_item;
-        memcpy(&in_item, head, sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
+        if (!ipc_progress_next(&r, IPC_GOAL_ITEM, &in)) return false;
         TrackableItem *dst_item = target->unlocks[i];
-        if (!dst_item) continue;
-        dst_item->done = in_item.done;
-        dst_item->progress = in_item.progress;
-        dst_item->initial_progress = in_item.initial_progress;
-        dst_item->is_manually_completed = in_item.is_manually_completed;
+        dst_item->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+        dst_item->progress = in.progress;
+        dst_item->initial_progress = in.initial_progress;
+        dst_item->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
     }
 
     for (int i = 0; i < target->custom_goal_count; i++) {
-        TrackableItem in_item;
-        memcpy(&in_item, head, sizeof(TrackableItem));
-        head += sizeof(TrackableItem);
+        if (!ipc_progress_next(&r, IPC_GOAL_ITEM, &in)) return false;
         TrackableItem *dst_item = target->custom_goals[i];
-        if (!dst_item) continue;
         // Skip if the receiver has an in-flight click/increment on this goal.
         if (tracker_pending_mod_should_skip("", dst_item->root_name)) continue;
-        dst_item->done = in_item.done;
-        dst_item->progress = in_item.progress;
-        dst_item->initial_progress = in_item.initial_progress;
-        dst_item->is_manually_completed = in_item.is_manually_completed;
-        memcpy(dst_item->custom_contributor_uuid, in_item.custom_contributor_uuid,
-               sizeof(dst_item->custom_contributor_uuid));
-        memcpy(dst_item->manual_completer_uuid, in_item.manual_completer_uuid,
-               sizeof(dst_item->manual_completer_uuid));
+        dst_item->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
+        dst_item->progress = in.progress;
+        dst_item->initial_progress = in.initial_progress;
+        dst_item->is_manually_completed = (in.flags & IPC_GOAL_FLAG_MANUAL) != 0;
+        merge_coop_face(dst_item->custom_contributor_uuid, sizeof(dst_item->custom_contributor_uuid),
+                        in.faces[IPC_GOAL_FACE_EXTRA]);
+        merge_coop_face(dst_item->manual_completer_uuid, sizeof(dst_item->manual_completer_uuid),
+                        in.faces[IPC_GOAL_FACE_MANUAL_COMPLETER]);
     }
 
     for (int i = 0; i < target->counter_goal_count; i++) {
-        CounterGoal in_cg;
-        memcpy(&in_cg, head, sizeof(CounterGoal));
-        head += sizeof(CounterGoal);
-
-        CounterGoal *dst = target->counter_goals[i];
-        if (!dst || dst->linked_goal_count != in_cg.linked_goal_count) {
-            log_message(LOG_ERROR, "[COOP] Merge skipped: linked goal count mismatch for counter %d.\n", i);
+        if (!ipc_progress_next(&r, IPC_GOAL_COUNTER, &in)) {
+            log_message(LOG_ERROR, "[COOP] Merge skipped: layout mismatch for counter %d.\n", i);
             return false;
         }
-        dst->completed_count = in_cg.completed_count;
-        dst->done = in_cg.done;
-
-        // Linked goals carry no dynamic state; skip over the wire bytes.
-        head += (size_t) in_cg.linked_goal_count * sizeof(CounterLinkedGoal);
+        CounterGoal *dst = target->counter_goals[i];
+        dst->completed_count = in.progress;
+        dst->done = (in.flags & IPC_GOAL_FLAG_DONE) != 0;
     }
 
     return true;
 }
 
 
-static void free_deserialized_data(TemplateData *td) {
-    if (!td) return;
-
-    if (td->advancements) {
-        for (int i = 0; i < td->advancement_count; i++) {
-            if (td->advancements[i]) {
-                if (td->advancements[i]->criteria) {
-                    for (int j = 0; j < td->advancements[i]->criteria_count; j++) {
-                        free(td->advancements[i]->criteria[j]);
-                    }
-                    free(td->advancements[i]->criteria);
-                }
-                free(td->advancements[i]);
-            }
-        }
-        free(td->advancements);
-    }
-
-    if (td->stats) {
-        for (int i = 0; i < td->stat_count; i++) {
-            if (td->stats[i]) {
-                if (td->stats[i]->criteria) {
-                    for (int j = 0; j < td->stats[i]->criteria_count; j++) {
-                        free(td->stats[i]->criteria[j]);
-                    }
-                    free(td->stats[i]->criteria);
-                }
-                free(td->stats[i]);
-            }
-        }
-        free(td->stats);
-    }
-
-    if (td->multi_stage_goals) {
-        for (int i = 0; i < td->multi_stage_goal_count; i++) {
-            if (td->multi_stage_goals[i]) {
-                if (td->multi_stage_goals[i]->stages) {
-                    for (int j = 0; j < td->multi_stage_goals[i]->stage_count; j++) {
-                        free(td->multi_stage_goals[i]->stages[j]);
-                    }
-                    free(td->multi_stage_goals[i]->stages);
-                }
-                free(td->multi_stage_goals[i]);
-            }
-        }
-        free(td->multi_stage_goals);
-    }
-
-    if (td->unlocks) {
-        for (int i = 0; i < td->unlock_count; i++) {
-            free(td->unlocks[i]);
-        }
-        free(td->unlocks);
-    }
-
-    if (td->custom_goals) {
-        for (int i = 0; i < td->custom_goal_count; i++) {
-            free(td->custom_goals[i]);
-        }
-        free(td->custom_goals);
-    }
-
-    if (td->counter_goals) {
-        for (int i = 0; i < td->counter_goal_count; i++) {
-            if (td->counter_goals[i]) {
-                free(td->counter_goals[i]->linked_goals);
-                free(td->counter_goals[i]);
-            }
-        }
-        free(td->counter_goals);
-    }
-
-    // Set pointers to nullptr after freeing to prevent double-freeing
-    memset(td, 0, sizeof(TemplateData));
-}
-
 // ===================== TEMP DEBUG: overlay heap-corruption bisection =====================
 // Walks every process heap (this is the same NT-heap validation whose failure fires the
 // ntdll fast-fail we've been chasing, so it catches the corruption the CRT malloc/free heap
@@ -1992,8 +1877,10 @@ int main(int argc, char *argv[]) {
             return 1;
         }
 
-        overlay->shm_fd = shm_open(SHARED_MEM_NAME, O_RDONLY, 0666);
-        overlay->p_shared_data = (SharedData *) mmap(0, sizeof(SharedData), PROT_READ, MAP_SHARED, overlay->shm_fd, 0);
+        // Read-write: the overlay relocates the template image in place (see IPCTemplateImage).
+        overlay->shm_fd = shm_open(SHARED_MEM_NAME, O_RDWR, 0666);
+        overlay->p_shared_data = (SharedData *) mmap(0, sizeof(SharedData), PROT_READ | PROT_WRITE, MAP_SHARED,
+                                                     overlay->shm_fd, 0);
 
         if (overlay->p_shared_data == MAP_FAILED) {
             log_message(LOG_ERROR, "[OVERLAY IPC] Failed to map shared memory. Is the tracker running?\n");
@@ -2003,18 +1890,39 @@ int main(int argc, char *argv[]) {
         }
 #endif
 
-        // This local struct will hold the REBUILT data.
-        TemplateData live_template_data{};
+        // Stand-in until the first template image arrives. Afterwards the proxy points straight at the
+        // TemplateData inside the pinned template slot, which the tracker never rewrites while pinned.
+        TemplateData empty_template_data{};
 
         // We create a "proxy" tracker struct to pass to the render functions.
         Tracker proxy_tracker{};
-        proxy_tracker.template_data = &live_template_data; // Point it to our local rebuilt data
+        proxy_tracker.template_data = &empty_template_data;
 
         // Co-op contributor faces (Compact mode) need the skin cache in this process too: the tracker
         // and overlay run as separate processes, each with its own cache. Started only after IPC setup
         // succeeded so the earlier error-exit paths don't have to join the worker thread.
         skin_cache_init(overlay->renderer);
 
+        // Header seqlock value and template generation this process last consumed (see SharedData).
+        // 0 is never a published value, so the first publish is always picked up.
+        int seen_header_seq = 0;
+        int seen_body_generation = 0;
+
+        // Goal records of the attached image, so the deltas appended to its slot apply without a walk,
+        // and how many of those deltas are applied already.
+        IPCGoalRef *goal_refs = nullptr;
+        int goal_ref_count = 0;
+        int applied_deltas = 0;
+        IPCTemplateTotals totals{};
+
+        // Between frames the loop sleeps until something is due (see overlay_next_frame_tick); new data
+        // from the tracker cuts that sleep short through the wake watcher.
+        if (!ipc_wakeup_open(&overlay->wakeup)) {
+            log_message(LOG_ERROR, "[OVERLAY IPC] Failed to open the wakeup event, polling for tracker data instead.\n");
+        }
+        OverlayWakeWatch wake_watch;
+        overlay_wake_watch_start(&wake_watch, overlay->p_shared_data, &overlay->wakeup);
+
         bool is_running = true;
         Uint32 last_frame_time = SDL_GetTicks();
 
@@ -2038,92 +1946,108 @@ int main(int argc, char *argv[]) {
             }
             // overlay_heapcheck("after_events"); // TEMP DEBUG
 
+            // Nothing here blocks: the header comes out of a seqlock and the template is read in place
+            // from a pinned slot that the tracker leaves alone until the next pin.
             if (overlay->p_shared_data) {
+                // If main process is shut down, shut down overlay
+                if (SDL_GetAtomicInt(&overlay->p_shared_data->shutdown_requested)) {
+                    is_running = false;
+                }
 #ifdef _WIN32
-                DWORD wait_result = WaitForSingleObject(overlay->h_mutex, 50);
-                if (wait_result == WAIT_OBJECT_0) {
-#else
-                    if (sem_wait(overlay->mutex) == 0) {
-#endif
-                    // --- Critical Section: We have the lock ---
-
-                    // If main process is shut down, shut down overlay
-                    if (overlay->p_shared_data->shutdown_requested) {
+                // The tracker owns the named mutex for its whole lifetime, so it only becomes ours if the
+                // tracker died without asking us to shut down.
+                if (is_running) {
+                    DWORD wait_result = WaitForSingleObject(overlay->h_mutex, 0);
+                    if (wait_result == WAIT_ABANDONED || wait_result == WAIT_OBJECT_0) {
+                        log_message(
+                            LOG_ERROR, "[OVERLAY IPC] Main tracker process terminated unexpectedly. Shutting down.\n");
+                        ReleaseMutex(overlay->h_mutex);
                         is_running = false;
                     }
+                }
+#endif
 
+                OverlayIPCHeader header;
+                int header_seq = 0;
+                if (SDL_GetAtomicInt(&overlay->p_shared_data->header_seq) != seen_header_seq &&
+                    ipc_read_header(overlay->p_shared_data, &header, &header_seq)) {
+                    seen_header_seq = header_seq;
+
+                    // Update the proxy tracker with the live data from the header.
+                    strncpy(proxy_tracker.world_name, header.world_name, MAX_PATH_LENGTH - 1);
+                    proxy_tracker.world_name[MAX_PATH_LENGTH - 1] = '\0';
+                    proxy_tracker.time_since_last_update = header.time_since_last_update;
+
+                    // Refresh the top-bar labels live from the header so a template/
+                    // version/category change updates the overlay without a restart.
+                    // overlay_render reads these from settings->..., so update that copy.
+                    strncpy(settings.version_str, header.version_str, sizeof(settings.version_str) - 1);
+                    settings.version_str[sizeof(settings.version_str) - 1] = '\0';
+                    strncpy(settings.display_version_str, header.display_version_str,
+                            sizeof(settings.display_version_str) - 1);
+                    settings.display_version_str[sizeof(settings.display_version_str) - 1] = '\0';
+                    strncpy(settings.category_display_name, header.category_display_name,
+                            sizeof(settings.category_display_name) - 1);
+                    settings.category_display_name[sizeof(settings.category_display_name) - 1] = '\0';
+
+                    // Live co-op view state for Compact-mode contributor faces (the overlay has no
+                    // g_coop_ctx). Copied onto the Overlay so the render path can read it via `o`.
+                    overlay->coop_lobby_active = header.coop_lobby_active;
+                    overlay->coop_all_players_view = header.coop_all_players_view;
+                    strncpy(overlay->coop_selected_uuid, header.coop_selected_uuid,
+                            sizeof(overlay->coop_selected_uuid) - 1);
+                    overlay->coop_selected_uuid[sizeof(overlay->coop_selected_uuid) - 1] = '\0';
+                    overlay->coop_selected_offline = header.coop_selected_offline;
+                    int hdr_lc = header.coop_lobby_count;
+                    if (hdr_lc < 0) hdr_lc = 0;
+                    if (hdr_lc > COOP_MAX_LOBBY) hdr_lc = COOP_MAX_LOBBY;
+                    overlay->coop_lobby_count = hdr_lc;
+                    for (int i = 0; i < hdr_lc; i++) {
+                        strncpy(overlay->coop_lobby[i].uuid, header.coop_lobby[i].uuid,
+                                sizeof(overlay->coop_lobby[i].uuid) - 1);
+                        overlay->coop_lobby[i].uuid[sizeof(overlay->coop_lobby[i].uuid) - 1] = '\0';
+                        overlay->coop_lobby[i].is_offline = header.coop_lobby[i].is_offline;
+                    }
 
-                    if (overlay->p_shared_data->data_size > 0) {
-                        // Define the same header struct to read the data.
-                        OverlayIPCHeader header;
-                        char *buffer_head = overlay->p_shared_data->buffer;
-
-                        // 1. Read the header from the start of the buffer.
-                        memcpy(&header, buffer_head, sizeof(OverlayIPCHeader));
-
-                        // 2. Update the proxy tracker with the live data from the header.
-                        strncpy(proxy_tracker.world_name, header.world_name, MAX_PATH_LENGTH - 1);
-                        proxy_tracker.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                        proxy_tracker.time_since_last_update = header.time_since_last_update;
-
-                        // Refresh the top-bar labels live from the header so a template/
-                        // version/category change updates the overlay without a restart.
-                        // overlay_render reads these from settings->..., so update that copy.
-                        strncpy(settings.version_str, header.version_str, sizeof(settings.version_str) - 1);
-                        settings.version_str[sizeof(settings.version_str) - 1] = '\0';
-                        strncpy(settings.display_version_str, header.display_version_str,
-                                sizeof(settings.display_version_str) - 1);
-                        settings.display_version_str[sizeof(settings.display_version_str) - 1] = '\0';
-                        strncpy(settings.category_display_name, header.category_display_name,
-                                sizeof(settings.category_display_name) - 1);
-                        settings.category_display_name[sizeof(settings.category_display_name) - 1] = '\0';
-
-                        // Live co-op view state for Compact-mode contributor faces (the overlay has no
-                        // g_coop_ctx). Copied onto the Overlay so the render path can read it via `o`.
-                        overlay->coop_lobby_active = header.coop_lobby_active;
-                        overlay->coop_all_players_view = header.coop_all_players_view;
-                        strncpy(overlay->coop_selected_uuid, header.coop_selected_uuid,
-                                sizeof(overlay->coop_selected_uuid) - 1);
-                        overlay->coop_selected_uuid[sizeof(overlay->coop_selected_uuid) - 1] = '\0';
-                        overlay->coop_selected_offline = header.coop_selected_offline;
-                        int hdr_lc = header.coop_lobby_count;
-                        if (hdr_lc < 0) hdr_lc = 0;
-                        if (hdr_lc > COOP_MAX_LOBBY) hdr_lc = COOP_MAX_LOBBY;
-                        overlay->coop_lobby_count = hdr_lc;
-                        for (int i = 0; i < hdr_lc; i++) {
-                            strncpy(overlay->coop_lobby[i].uuid, header.coop_lobby[i].uuid,
-                                    sizeof(overlay->coop_lobby[i].uuid) - 1);
-                            overlay->coop_lobby[i].uuid[sizeof(overlay->coop_lobby[i].uuid) - 1] = '\0';
-                            overlay->coop_lobby[i].is_offline = header.coop_lobby[i].is_offline;
-                        }
-
-                        // Only deserialize the heavy template data if it's actually there (size > header)
-                        if (overlay->p_shared_data->data_size > sizeof(OverlayIPCHeader)) {
-                            buffer_head += sizeof(OverlayIPCHeader); // Move pointer past the header.
-
-                            // 3. Free the template data from the PREVIOUS frame.
-                            free_deserialized_data(&live_template_data);
-                            // overlay_heapcheck("after_free_deserialized"); // TEMP DEBUG
+                    totals = header.totals;
+                    if (proxy_tracker.template_data != &empty_template_data) {
+                        ipc_apply_totals(proxy_tracker.template_data, &totals);
+                    }
+                }
 
-                            // 4. Deserialize the main template data, which starts AFTER the header.
-                            deserialize_template_data(buffer_head, &live_template_data);
-                            // overlay_heapcheck("after_deserialize"); // TEMP DEBUG
+                // Re-pinning every frame moves us to the newest image as soon as it's published. It's only
+                // re-attached (validated and, the first time this process sees it, relocated in place) when
+                // the generation changed; on every other frame the TemplateData from the last attach is current.
+                // A template that outgrew its segment moves to a new one; the pin maps it when that happens.
+                IPCTemplateSlot *slot = ipc_pin_latest_template(overlay->p_shared_data, &overlay->template_segment);
+                if (slot && slot->body_generation != seen_body_generation) {
+                    seen_body_generation = slot->body_generation;
+                    TemplateData *image_td = nullptr;
+                    if (slot->image_size > 0) {
+                        image_td = ipc_attach_template_image(ipc_template_slot_image(slot), slot->image_size);
+                    }
+                    proxy_tracker.template_data = image_td ? image_td : &empty_template_data;
+
+                    free(goal_refs);
+                    goal_refs = nullptr;
+                    goal_ref_count = 0;
+                    applied_deltas = 0;
+                    if (image_td) {
+                        int count = ipc_count_goals(image_td);
+                        goal_refs = (IPCGoalRef *) malloc((size_t) (count > 0 ? count : 1) * sizeof(IPCGoalRef));
+                        if (goal_refs) {
+                            ipc_index_goals(image_td, goal_refs);
+                            goal_ref_count = count;
                         }
+                        // The header may be newer than the image it was published with
+                        ipc_apply_totals(image_td, &totals);
                     }
-                    // --- End of Critical Section ---
-#ifdef _WIN32
-                    ReleaseMutex(overlay->h_mutex);
-#else
-                    sem_post(overlay->mutex);
-#endif
                 }
-#ifdef _WIN32
-                else if (wait_result == WAIT_ABANDONED) {
-                    log_message(
-                        LOG_ERROR, "[OVERLAY IPC] Main tracker process terminated unexpectedly. Shutting down.\n");
-                    is_running = false;
+
+                // Progress published since the image was written
+                if (slot && goal_refs) {
+                    ipc_apply_goal_deltas(slot, goal_refs, goal_ref_count, &applied_deltas);
                 }
-#endif
             }
 
 
@@ -2144,9 +2068,25 @@ int main(int argc, char *argv[]) {
             if (frame_time < frame_target_time) {
                 SDL_Delay((Uint32) (frame_target_time - frame_time));
             }
+
+            // Nothing moving by itself: sleep until the next timed change, new tracker data or input.
+            // Without the wake watcher new data would wait for the deadline, so keep the frame rate then.
+            Uint64 next_frame_tick = overlay_next_frame_tick();
+            Uint64 now = SDL_GetTicks();
+            if (is_running && wake_watch.thread && next_frame_tick > now) {
+                Uint64 wait_ms = next_frame_tick - now;
+                if (wait_ms > OVERLAY_IDLE_WAKE_MS) wait_ms = OVERLAY_IDLE_WAKE_MS;
+                SDL_WaitEventTimeout(nullptr, (Sint32) wait_ms);
+            }
         } // END OF OVERLAY LOOP
 
+        overlay_wake_watch_stop(&wake_watch);
+        ipc_wakeup_close(&overlay->wakeup);
+        free(goal_refs);
+
         // Clean up IPC handles
+        proxy_tracker.template_data = &empty_template_data;
+        ipc_template_segment_close(&overlay->template_segment, false);
 #ifdef _WIN32
         UnmapViewOfFile(overlay->p_shared_data);
         CloseHandle(overlay->h_map_file);
@@ -2157,9 +2097,6 @@ int main(int argc, char *argv[]) {
         sem_close(overlay->mutex);
 #endif
 
-        // Final cleanup call before exiting
-        free_deserialized_data(&live_template_data);
-
         // Persist the overlay's final position/size on shutdown. This is the ONLY
         // place the overlay writes geometry — per-move saves are avoided to prevent
         // spurious tracker dmon reloads.
@@ -2286,6 +2223,9 @@ int main(int argc, char *argv[]) {
     // avoid a stack overflow in the chkstk probe at startup.
     static AppSettings app_settings;
 
+    // Progress changes a crashed run only journaled go into settings.json before anything else writes it
+    settings_progress_journal_recover();
+
     if (settings_load(&app_settings)) {
         // ----- This is the only if statement with print_debug_status outside of logger -----------
         if (app_settings.print_debug_status) {
@@ -2407,8 +2347,10 @@ int main(int argc, char *argv[]) {
 
         log_message(LOG_INFO, "[IPC] Creating shared memory and mutex...\n");
 #ifdef _WIN32
-        // Create a named mutex for synchronization
-        tracker->h_mutex = CreateMutexA(nullptr, FALSE, MUTEX_NAME);
+        // Create the named mutex the overlay opens to find the tracker. Shared memory is exchanged
+        // lock-free (see SharedData); the mutex is owned for the tracker's lifetime, so the overlay
+        // sees it abandoned if the tracker dies.
+        tracker->h_mutex = CreateMutexA(nullptr, TRUE, MUTEX_NAME);
         if (tracker->h_mutex == nullptr) {
             log_message(LOG_ERROR, "[IPC] Failed to create mutex: %s\n", SDL_GetError());
 
@@ -2419,6 +2361,23 @@ int main(int argc, char *argv[]) {
             log_close();
             return EXIT_FAILURE;
         }
+        // If the mutex already exists (e.g. an overlay from an earlier run still holds a handle), Windows
+        // ignores the initial-owner request. Take ownership explicitly, or the overlay would see the mutex
+        // free and shut down thinking the tracker died. Stale overlays only ever hold it for an instant.
+        if (GetLastError() == ERROR_ALREADY_EXISTS) {
+            DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 5000);
+            if (wait_result != WAIT_OBJECT_0 && wait_result != WAIT_ABANDONED) {
+                log_message(LOG_ERROR, "[IPC] Failed to take ownership of the existing mutex. Result: %lu\n",
+                            wait_result);
+
+                // Free resources and exit
+                tracker_free(&tracker, &app_settings);
+                TTF_Quit();
+                SDL_Quit();
+                log_close();
+                return EXIT_FAILURE;
+            }
+        }
 
         // Create the shared memory file mapping
         tracker->h_map_file = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(SharedData),
@@ -2448,7 +2407,8 @@ int main(int argc, char *argv[]) {
             return EXIT_FAILURE;
         }
 #else
-        // Create/open a named semaphore (acting as a mutex)
+        // Create/open a named semaphore. Shared memory is exchanged lock-free (see SharedData), the
+        // overlay only opens it to find the tracker.
         tracker->mutex = sem_open(MUTEX_NAME, O_CREAT, 0644, 1);
         if (tracker->mutex == SEM_FAILED) {
             log_message(LOG_ERROR, "[IPC] Failed to create semaphore.\n");
@@ -2466,11 +2426,16 @@ int main(int argc, char *argv[]) {
         (void) ftruncate(tracker->shm_fd, sizeof(SharedData));
 
         // Map the shared memory object
-        tracker->p_shared_data = (SharedData *) mmap(0, sizeof(SharedData), PROT_WRITE, MAP_SHARED, tracker->shm_fd, 0);
+        // Readable too: the header publish compares against the copy already in shared memory.
+        tracker->p_shared_data = (SharedData *) mmap(0, sizeof(SharedData), PROT_READ | PROT_WRITE, MAP_SHARED,
+                                                     tracker->shm_fd, 0);
 #endif
 
-        // Initialize the shutdown flag
-        tracker->p_shared_data->shutdown_requested = false;
+        // Initialize the shutdown flag and the publish state
+        ipc_shared_init(tracker->p_shared_data);
+        if (!ipc_wakeup_open(&tracker->ipc_wakeup)) {
+            log_message(LOG_ERROR, "[IPC] Failed to create the overlay wakeup event, the overlay polls instead.\n");
+        }
 
         // Initialize ImGUI
         IMGUI_CHECKVERSION();
@@ -3017,15 +2982,8 @@ int main(int argc, char *argv[]) {
 
                     // 1. Request shutdown via Shared Memory
                     if (tracker->p_shared_data) {
-#ifdef _WIN32
-                        WaitForSingleObject(tracker->h_mutex, 100);
-                        tracker->p_shared_data->shutdown_requested = true;
-                        ReleaseMutex(tracker->h_mutex);
-#else
-                        sem_wait(tracker->mutex);
-                        tracker->p_shared_data->shutdown_requested = true;
-                        sem_post(tracker->mutex);
-#endif
+                        SDL_SetAtomicInt(&tracker->p_shared_data->shutdown_requested, 1);
+                        ipc_wakeup_signal(tracker->p_shared_data, &tracker->ipc_wakeup);
                     }
 
                     // 2. Wait for the process to exit cleanly (up to 500ms)
@@ -3061,15 +3019,7 @@ int main(int argc, char *argv[]) {
 
                 // Reset the shutdown flag so the NEW process doesn't immediately exit
                 if (tracker->p_shared_data) {
-#ifdef _WIN32
-                    WaitForSingleObject(tracker->h_mutex, 100);
-                    tracker->p_shared_data->shutdown_requested = false;
-                    ReleaseMutex(tracker->h_mutex);
-#else
-                    sem_wait(tracker->mutex);
-                    tracker->p_shared_data->shutdown_requested = false;
-                    sem_post(tracker->mutex);
-#endif
+                    SDL_SetAtomicInt(&tracker->p_shared_data->shutdown_requested, 0);
                 }
 
                 // The overlay's exit-save just wrote its actual SDL window geometry.
@@ -3259,34 +3209,7 @@ int main(int argc, char *argv[]) {
                     tracker_update_title(tracker, &app_settings);
 
                     if (tracker->p_shared_data) {
-#ifdef _WIN32
-                        DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 50);
-                        if (wait_result == WAIT_OBJECT_0) {
-#else
-                            if (sem_wait(tracker->mutex) == 0) {
-#endif
-                            OverlayIPCHeader header;
-                            // For receivers, show co-op sync label in overlay world name
-                            if (!tracker_build_coop_sync_label(tracker, &app_settings,
-                                                               header.world_name, MAX_PATH_LENGTH)) {
-                                strncpy(header.world_name, tracker->world_name, MAX_PATH_LENGTH - 1);
-                                header.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                            }
-                            header.time_since_last_update = tracker->time_since_last_update;
-                            fill_overlay_ipc_labels(&header, &app_settings);
-                            fill_overlay_coop_state(&header, tracker, &app_settings);
-
-                            char *buffer_head = tracker->p_shared_data->buffer;
-                            memcpy(buffer_head, &header, sizeof(OverlayIPCHeader));
-                            buffer_head += sizeof(OverlayIPCHeader);
-                            size_t template_data_size = serialize_template_data(tracker->template_data, buffer_head);
-                            tracker->p_shared_data->data_size = sizeof(OverlayIPCHeader) + template_data_size;
-#ifdef _WIN32
-                            ReleaseMutex(tracker->h_mutex);
-#else
-                            sem_post(tracker->mutex);
-#endif
-                        }
+                        write_overlay_ipc_payload(tracker, &app_settings);
                     }
 
                     // Co-op Host: broadcast Hermes-updated state to receivers immediately.
@@ -3302,9 +3225,13 @@ int main(int argc, char *argv[]) {
                         } else {
                             char *broadcast_buf = (char *) malloc(4 * 1024 * 1024);
                             if (broadcast_buf) {
-                                size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf);
+                                size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf,
+                                                                                4 * 1024 * 1024);
                                 if (broadcast_size > 0) {
                                     coop_net_broadcast(g_coop_ctx, broadcast_buf, broadcast_size);
+                                } else {
+                                    log_message(LOG_ERROR, "[COOP] Host state doesn't fit the broadcast buffer, "
+                                                "not broadcasting.\n");
                                 }
                                 free(broadcast_buf);
                             }
@@ -3466,10 +3393,11 @@ int main(int argc, char *argv[]) {
 
                 if (new_data) {
                     log_message(LOG_INFO, "[COOP DEBUG] Receiver: data ready. buf=%p size=%zu "
-                                "sizeof(TemplateData)=%zu template_data=%p\n",
+                                "valid=%s template_data=%p\n",
                                 (void *) g_coop_ctx->recv_buffer,
                                 g_coop_ctx->recv_buffer_size,
-                                sizeof(TemplateData),
+                                ipc_progress_state_valid(g_coop_ctx->recv_buffer, g_coop_ctx->recv_buffer_size)
+                                    ? "yes" : "NO",
                                 (void *) tracker->template_data);
                 }
 
@@ -3489,18 +3417,18 @@ int main(int argc, char *argv[]) {
                                   : sel;
 
                     if (eff >= 0 && eff < g_coop_ctx->recv_player_snapshot_count &&
-                        g_coop_ctx->recv_player_buffers[eff] &&
-                        g_coop_ctx->recv_player_buffer_sizes[eff] >= sizeof(TemplateData)) {
+                        ipc_progress_state_valid(g_coop_ctx->recv_player_buffers[eff],
+                                                 g_coop_ctx->recv_player_buffer_sizes[eff])) {
                         // Apply per-player (or per-ghost) snapshot
                         apply_buf = g_coop_ctx->recv_player_buffers[eff];
                         apply_size = g_coop_ctx->recv_player_buffer_sizes[eff];
-                    } else if (g_coop_ctx->recv_merged_snapshot &&
-                               g_coop_ctx->recv_merged_snapshot_size >= sizeof(TemplateData)) {
+                    } else if (ipc_progress_state_valid(g_coop_ctx->recv_merged_snapshot,
+                                                        g_coop_ctx->recv_merged_snapshot_size)) {
                         // Fall back to merged snapshot
                         apply_buf = g_coop_ctx->recv_merged_snapshot;
                         apply_size = g_coop_ctx->recv_merged_snapshot_size;
-                    } else if (new_data && g_coop_ctx->recv_buffer &&
-                               g_coop_ctx->recv_buffer_size >= sizeof(TemplateData)) {
+                    } else if (new_data && ipc_progress_state_valid(g_coop_ctx->recv_buffer,
+                                                                    g_coop_ctx->recv_buffer_size)) {
                         // First data arrival, no persistent snapshot yet
                         apply_buf = g_coop_ctx->recv_buffer;
                         apply_size = g_coop_ctx->recv_buffer_size;
@@ -3545,9 +3473,10 @@ int main(int argc, char *argv[]) {
                         }
                     } else if (new_data) {
                         log_message(LOG_ERROR, "[COOP DEBUG] Receiver: data ready but SKIPPED. "
-                                    "buf=%s size_ok=%s template=%s\n",
+                                    "buf=%s valid=%s template=%s\n",
                                     g_coop_ctx->recv_buffer ? "yes" : "NO",
-                                    g_coop_ctx->recv_buffer_size >= sizeof(TemplateData) ? "yes" : "NO",
+                                    ipc_progress_state_valid(g_coop_ctx->recv_buffer, g_coop_ctx->recv_buffer_size)
+                                        ? "yes" : "NO",
                                     tracker->template_data ? "yes" : "NO");
                     }
 
@@ -3605,7 +3534,7 @@ int main(int argc, char *argv[]) {
                     tracker_update_coop_merged(tracker, &app_settings);
                     view_rebuilt = true;
                 }
-                if (view_rebuilt || (buf && sz >= sizeof(TemplateData))) {
+                if (view_rebuilt || ipc_progress_state_valid(buf, sz)) {
                     if (buf) merge_coop_progress(buf, tracker->template_data);
                     tracker_recalculate_progress(tracker, &app_settings);
                     tracker_update_title(tracker, &app_settings);
@@ -3618,32 +3547,7 @@ int main(int argc, char *argv[]) {
                     // merged snapshot. A host-side dropdown switch is purely a
                     // local view change and must not touch the network.
                     if (tracker->p_shared_data) {
-#ifdef _WIN32
-                        DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 50);
-                        if (wait_result == WAIT_OBJECT_0) {
-#else
-                            if (sem_wait(tracker->mutex) == 0) {
-#endif
-                            OverlayIPCHeader header;
-                            if (!tracker_build_coop_sync_label(tracker, &app_settings,
-                                                               header.world_name, MAX_PATH_LENGTH)) {
-                                strncpy(header.world_name, tracker->world_name, MAX_PATH_LENGTH - 1);
-                                header.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                            }
-                            header.time_since_last_update = tracker->time_since_last_update;
-                            fill_overlay_ipc_labels(&header, &app_settings);
-                            fill_overlay_coop_state(&header, tracker, &app_settings);
-                            char *buffer_head = tracker->p_shared_data->buffer;
-                            memcpy(buffer_head, &header, sizeof(OverlayIPCHeader));
-                            buffer_head += sizeof(OverlayIPCHeader);
-                            size_t td_sz = serialize_template_data(tracker->template_data, buffer_head);
-                            tracker->p_shared_data->data_size = sizeof(OverlayIPCHeader) + td_sz;
-#ifdef _WIN32
-                            ReleaseMutex(tracker->h_mutex);
-#else
-                            sem_post(tracker->mutex);
-#endif
-                        }
+                        write_overlay_ipc_payload(tracker, &app_settings);
                     }
                 }
             }
@@ -3722,16 +3626,15 @@ int main(int argc, char *argv[]) {
                         size_t saved_view_size = 0;
                         if (saved_view && pp_work) {
                             saved_view_size = serialize_template_data(tracker->template_data,
-                                                                      saved_view);
+                                                                      saved_view, 4 * 1024 * 1024);
 
                             // Refresh per-player snapshots for dirty players only.
                             for (int d = 0; d < dirty_count; d++) {
                                 int pi = dirty_idx[d];
                                 tracker_update_coop_single_player(tracker, &app_settings, pi);
-                                size_t sz = serialize_template_data(tracker->template_data, pp_work);
-                                char *buf = (char *) malloc(sz);
+                                size_t sz = serialize_template_data(tracker->template_data, pp_work, 4 * 1024 * 1024);
+                                char *buf = coop_snapshot_copy(pp_work, sz, "Player");
                                 if (buf) {
-                                    memcpy(buf, pp_work, sz);
                                     free(tracker->coop_player_snapshots[pi]);
                                     tracker->coop_player_snapshots[pi] = buf;
                                     tracker->coop_player_snapshot_sizes[pi] = sz;
@@ -3743,10 +3646,10 @@ int main(int argc, char *argv[]) {
                             // merge rules (Any Player / Host Only / Cumulative /
                             // Highest) instead of an optimistic per-click overwrite.
                             tracker_update_coop_merged(tracker, &app_settings);
-                            size_t merged_sz = serialize_template_data(tracker->template_data, pp_work);
-                            char *merged_buf = (char *) malloc(merged_sz);
+                            size_t merged_sz = serialize_template_data(tracker->template_data, pp_work,
+                                                                       4 * 1024 * 1024);
+                            char *merged_buf = coop_snapshot_copy(pp_work, merged_sz, "Merged");
                             if (merged_buf) {
-                                memcpy(merged_buf, pp_work, merged_sz);
                                 free(tracker->coop_merged_snapshot);
                                 tracker->coop_merged_snapshot = merged_buf;
                                 tracker->coop_merged_snapshot_size = merged_sz;
@@ -3759,8 +3662,8 @@ int main(int argc, char *argv[]) {
                             // its disk + settings.json subtree didn't change).
                             int sel = tracker->selected_coop_player_idx;
                             if (sel >= 0 && sel < MAX_COOP_PLAYERS &&
-                                tracker->coop_player_snapshots[sel] &&
-                                tracker->coop_player_snapshot_sizes[sel] >= sizeof(TemplateData)) {
+                                ipc_progress_state_valid(tracker->coop_player_snapshots[sel],
+                                                         tracker->coop_player_snapshot_sizes[sel])) {
                                 merge_coop_progress(tracker->coop_player_snapshots[sel],
                                                     tracker->template_data);
                             } else if (sel >= 0 && saved_view_size > 0) {
@@ -3925,7 +3828,8 @@ int main(int argc, char *argv[]) {
                         size_t merged_snapshot_size = 0; {
                             char *broadcast_buf = (char *) malloc(4 * 1024 * 1024);
                             if (broadcast_buf) {
-                                size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf);
+                                size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf,
+                                                                                4 * 1024 * 1024);
                                 log_message(
                                     LOG_INFO, "[COOP DEBUG] Host: broadcast_size=%zu, overall_progress=%.1f%%\n",
                                     broadcast_size,
@@ -3934,13 +3838,10 @@ int main(int argc, char *argv[]) {
                                         : -1.0f);
                                 if (broadcast_size > 0) {
                                     coop_net_broadcast(g_coop_ctx, broadcast_buf, broadcast_size);
-                                    // Keep a copy so we can restore merged view without re-reading disk
-                                    merged_snapshot = (char *) malloc(broadcast_size);
-                                    if (merged_snapshot) {
-                                        memcpy(merged_snapshot, broadcast_buf, broadcast_size);
-                                        merged_snapshot_size = broadcast_size;
-                                    }
                                 }
+                                // Keep a copy so we can restore merged view without re-reading disk
+                                merged_snapshot = coop_snapshot_copy(broadcast_buf, broadcast_size, "Merged");
+                                if (merged_snapshot) merged_snapshot_size = broadcast_size;
                                 free(broadcast_buf);
                             }
                         }
@@ -3979,20 +3880,26 @@ int main(int argc, char *argv[]) {
                             if (pp_bufs && pp_sizes && pp_work) {
                                 for (int pi = 0; pi < pc; pi++) {
                                     tracker_update_coop_single_player(tracker, &app_settings, pi);
-                                    size_t sz = serialize_template_data(tracker->template_data, pp_work);
-                                    pp_bufs[pi] = (char *) malloc(sz);
+                                    size_t sz = serialize_template_data(tracker->template_data, pp_work,
+                                                                        4 * 1024 * 1024);
+                                    pp_bufs[pi] = coop_snapshot_copy(pp_work, sz, "Player");
                                     if (pp_bufs[pi]) {
-                                        memcpy(pp_bufs[pi], pp_work, sz);
                                         pp_sizes[pi] = sz;
+                                    } else if (sz == 0 && tracker->coop_player_snapshots[pi]) {
+                                        // Re-send and keep the player's last valid snapshot
+                                        pp_bufs[pi] = coop_snapshot_copy(tracker->coop_player_snapshots[pi],
+                                                                         tracker->coop_player_snapshot_sizes[pi],
+                                                                         "Player");
+                                        if (pp_bufs[pi]) pp_sizes[pi] = tracker->coop_player_snapshot_sizes[pi];
                                     }
                                 }
                                 for (int gi = 0; gi < gn; gi++) {
                                     tracker_update_coop_single_player_by_uuid(tracker, &app_settings,
                                                                               ghost_uuids[gi], "");
-                                    size_t sz = serialize_template_data(tracker->template_data, pp_work);
-                                    pp_bufs[pc + gi] = (char *) malloc(sz);
+                                    size_t sz = serialize_template_data(tracker->template_data, pp_work,
+                                                                        4 * 1024 * 1024);
+                                    pp_bufs[pc + gi] = coop_snapshot_copy(pp_work, sz, "Ghost player");
                                     if (pp_bufs[pc + gi]) {
-                                        memcpy(pp_bufs[pc + gi], pp_work, sz);
                                         pp_sizes[pc + gi] = sz;
                                     }
                                 }
@@ -4043,6 +3950,9 @@ int main(int argc, char *argv[]) {
                                                         tracker->template_data);
                                 } else if (merged_snapshot) {
                                     merge_coop_progress(merged_snapshot, tracker->template_data);
+                                } else if (ipc_progress_state_valid(tracker->coop_merged_snapshot,
+                                                                    tracker->coop_merged_snapshot_size)) {
+                                    merge_coop_progress(tracker->coop_merged_snapshot, tracker->template_data);
                                 }
                                 tracker_recalculate_progress(tracker, &app_settings);
                             }
@@ -4051,13 +3961,14 @@ int main(int argc, char *argv[]) {
                             free(pp_work);
                         }
 
-                        // Cache the merged snapshot on the tracker too. Ownership transfers.
-                        if (tracker->coop_merged_snapshot) {
+                        // Cache the merged snapshot on the tracker too. Ownership transfers. Without a new
+                        // one (state didn't fit), the last valid merged snapshot stays cached.
+                        if (merged_snapshot) {
                             free(tracker->coop_merged_snapshot);
+                            tracker->coop_merged_snapshot = merged_snapshot;
+                            tracker->coop_merged_snapshot_size = merged_snapshot_size;
+                            merged_snapshot = nullptr;
                         }
-                        tracker->coop_merged_snapshot = merged_snapshot;
-                        tracker->coop_merged_snapshot_size = merged_snapshot_size;
-                        merged_snapshot = nullptr;
 
                         // Manual toggles / custom goal changes drove us through a full
                         // disk rebuild, which wiped any Hermes progress that hadn't yet
@@ -4135,45 +4046,7 @@ int main(int argc, char *argv[]) {
 
                 // --- DATA WRITING TO COMMUNICATE WITH OVERLAY ---
                 if (tracker->p_shared_data) {
-#ifdef _WIN32
-                    DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 50); // Wait up to 50ms
-                    if (wait_result == WAIT_OBJECT_0) {
-#else
-                        if (sem_wait(tracker->mutex) == 0) {
-#endif
-                        // --- Critical Section: We have the lock ---
-
-                        OverlayIPCHeader header;
-                        // For receivers, show co-op sync label in overlay world name
-                        if (!tracker_build_coop_sync_label(tracker, &app_settings,
-                                                           header.world_name, MAX_PATH_LENGTH)) {
-                            strncpy(header.world_name, tracker->world_name, MAX_PATH_LENGTH - 1);
-                            header.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                        }
-                        header.time_since_last_update = tracker->time_since_last_update;
-                        fill_overlay_ipc_labels(&header, &app_settings);
-                        fill_overlay_coop_state(&header, tracker, &app_settings);
-
-                        // Get a pointer to the beginning of the shared buffer.
-                        char *buffer_head = tracker->p_shared_data->buffer;
-
-                        // 1. Copy the header to the start of the buffer.
-                        memcpy(buffer_head, &header, sizeof(OverlayIPCHeader));
-                        buffer_head += sizeof(OverlayIPCHeader); // Move the pointer past the header.
-
-                        // 2. Serialize the main template data immediately after the header.
-                        size_t template_data_size = serialize_template_data(tracker->template_data, buffer_head);
-
-                        // 3. The total data size is the header + the serialized template data.
-                        tracker->p_shared_data->data_size = sizeof(OverlayIPCHeader) + template_data_size;
-
-                        // --- End of Critical Section ---
-#ifdef _WIN32
-                        ReleaseMutex(tracker->h_mutex);
-#else
-                        sem_post(tracker->mutex);
-#endif
-                    }
+                    write_overlay_ipc_payload(tracker, &app_settings);
                 }
             }
 
@@ -4205,9 +4078,13 @@ int main(int argc, char *argv[]) {
                     } else {
                         char *broadcast_buf = (char *) malloc(4 * 1024 * 1024);
                         if (broadcast_buf) {
-                            size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf);
+                            size_t broadcast_size = serialize_template_data(tracker->template_data, broadcast_buf,
+                                                                            4 * 1024 * 1024);
                             if (broadcast_size > 0) {
                                 coop_net_broadcast(g_coop_ctx, broadcast_buf, broadcast_size);
+                            } else {
+                                log_message(LOG_ERROR, "[COOP] Host state doesn't fit the broadcast buffer, "
+                                            "not broadcasting.\n");
                             }
                             free(broadcast_buf);
                         }
@@ -4245,71 +4122,23 @@ int main(int argc, char *argv[]) {
 
                 // IPC write to overlay
                 if (tracker->p_shared_data) {
-#ifdef _WIN32
-                    DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 50);
-                    if (wait_result == WAIT_OBJECT_0) {
-#else
-                        if (sem_wait(tracker->mutex) == 0) {
-#endif
-                        OverlayIPCHeader header;
-                        if (!tracker_build_coop_sync_label(tracker, &app_settings,
-                                                           header.world_name, MAX_PATH_LENGTH)) {
-                            strncpy(header.world_name, tracker->world_name, MAX_PATH_LENGTH - 1);
-                            header.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                        }
-                        header.time_since_last_update = tracker->time_since_last_update;
-                        fill_overlay_ipc_labels(&header, &app_settings);
-                        fill_overlay_coop_state(&header, tracker, &app_settings);
-                        char *buffer_head = tracker->p_shared_data->buffer;
-                        memcpy(buffer_head, &header, sizeof(OverlayIPCHeader));
-                        buffer_head += sizeof(OverlayIPCHeader);
-                        size_t template_data_size = serialize_template_data(tracker->template_data, buffer_head);
-                        tracker->p_shared_data->data_size = sizeof(OverlayIPCHeader) + template_data_size;
-#ifdef _WIN32
-                        ReleaseMutex(tracker->h_mutex);
-#else
-                        sem_post(tracker->mutex);
-#endif
-                    }
+                    write_overlay_ipc_payload(tracker, &app_settings);
                 }
             }
 
             // Continuous Update - Update the time in shared memory every frame so the overlay timer ticks
             else if (tracker->p_shared_data) {
                 PROFILE_SCOPE("ipc_header_continuous");
-#ifdef _WIN32
-                if (WaitForSingleObject(tracker->h_mutex, 5) == WAIT_OBJECT_0) {
-#else
-                    if (sem_wait(tracker->mutex) == 0) {
-#endif
-                    // Update ONLY the header part of shared memory to keep the timer in sync
-                    OverlayIPCHeader header;
-                    // For receivers, show co-op sync label in overlay world name
-                    if (!tracker_build_coop_sync_label(tracker, &app_settings,
-                                                       header.world_name, MAX_PATH_LENGTH)) {
-                        strncpy(header.world_name, tracker->world_name, MAX_PATH_LENGTH - 1);
-                        header.world_name[MAX_PATH_LENGTH - 1] = '\0';
-                    }
-                    header.time_since_last_update = tracker->time_since_last_update;
-                    fill_overlay_ipc_labels(&header, &app_settings);
-                    fill_overlay_coop_state(&header, tracker, &app_settings);
-
-                    // Write header at the start of buffer
-                    memcpy(tracker->p_shared_data->buffer, &header, sizeof(OverlayIPCHeader));
-
-                    // Do NOT change data_size here if we aren't writing the full payload,
-                    // or ensure data_size reflects valid data.
-                    // Since we aren't overwriting the template data part of the buffer, it remains valid.
-
-#ifdef _WIN32
-                    ReleaseMutex(tracker->h_mutex);
-#else
-                    sem_post(tracker->mutex);
-#endif
-                }
+                // Update ONLY the header to keep the timer in sync. The published template slot isn't
+                // touched, so it remains valid.
+                write_overlay_ipc_header(tracker, &app_settings);
             }
             PROFILE_END(needs_update);
 
+            PROFILE_BEGIN(progress_journal, "progress_journal_tick");
+            settings_progress_journal_tick();
+            PROFILE_END(progress_journal);
+
             // --- Update Title Bar Timer ---
             // Refresh the window title every 0.1s to update the "Upd:" timer, very light-weight operation
             PROFILE_BEGIN(update_title, "tracker_update_title");
@@ -4822,6 +4651,7 @@ int main(int argc, char *argv[]) {
         // Joined before the tracker is torn down: the poller only touches its own state and the
         // logger, but it must not outlive either.
         instance_poller_stop();
+        settings_progress_journal_shutdown();
         profiler_shutdown();
         exit_status = EXIT_SUCCESS;
     }
@@ -4838,19 +4668,8 @@ int main(int argc, char *argv[]) {
 
         // 1. Set the shutdown flag using shared memory
         if (tracker && tracker->p_shared_data) {
-#ifdef _WIN32
-            DWORD wait_result = WaitForSingleObject(tracker->h_mutex, 1000); // Wait up to 1 sec
-            if (wait_result == WAIT_OBJECT_0) {
-#else
-                if (sem_wait(tracker->mutex) == 0) {
-#endif
-                tracker->p_shared_data->shutdown_requested = true;
-#ifdef _WIN32
-                ReleaseMutex(tracker->h_mutex);
-#else
-                sem_post(tracker->mutex);
-#endif
-            }
+            SDL_SetAtomicInt(&tracker->p_shared_data->shutdown_requested, 1);
+            ipc_wakeup_signal(tracker->p_shared_data, &tracker->ipc_wakeup);
         }
 
         // 2. Wait for a moment for the process to close on its own
@@ -4878,17 +4697,8 @@ int main(int argc, char *argv[]) {
         // An overlay running as its own process isn't ours to kill, but it reads shared memory that
         // is about to be torn down, so ask it to close the same graceful way and give it a moment.
         log_message(LOG_INFO, "[MAIN] Requesting the detached overlay process to shut down...\n");
-#ifdef _WIN32
-        if (WaitForSingleObject(tracker->h_mutex, 1000) == WAIT_OBJECT_0) {
-            tracker->p_shared_data->shutdown_requested = true;
-            ReleaseMutex(tracker->h_mutex);
-        }
-#else
-        if (sem_wait(tracker->mutex) == 0) {
-            tracker->p_shared_data->shutdown_requested = true;
-            sem_post(tracker->mutex);
-        }
-#endif
+        SDL_SetAtomicInt(&tracker->p_shared_data->shutdown_requested, 1);
+        ipc_wakeup_signal(tracker->p_shared_data, &tracker->ipc_wakeup);
         SDL_Delay(500);
     }
 
@@ -4896,6 +4706,8 @@ int main(int argc, char *argv[]) {
 
     log_message(LOG_INFO, "[IPC] Cleaning up shared memory and mutex.\n");
     if (tracker && tracker->p_shared_data) {
+        ipc_template_segment_close(&tracker->ipc_template_segment, true);
+        ipc_wakeup_close(&tracker->ipc_wakeup);
 #ifdef _WIN32
         UnmapViewOfFile(tracker->p_shared_data);
         CloseHandle(tracker->h_map_file);
@@ -14,6 +14,7 @@
 #include "logger.h"
 #include "supporters.h"
 #include "skin_cache.h" // Co-op contributor faces in Compact mode
+#include "profiler.h" // Text cache and glyph atlas counters
 
 #include <cstdio>
 #include <cstdlib>
@@ -127,36 +128,129 @@ typedef struct {
     AnimatedTexture *background_anim;
 } SupporterRenderInfo;
 
+// Upper bound on cached text textures. Volatile strings (the IGT/timer in the top
+// info bar change every frame) would otherwise grow this without limit; once the cap
+// is hit the least-recently-used entry is evicted so memory stays bounded.
+#define MAX_TEXT_CACHE_ENTRIES 512
+
+// Slots of the open-addressing table indexing the text cache. A power of two, at least twice the
+// entry cap so probe runs stay short even with the cache full.
+#define TEXT_CACHE_TABLE_SIZE 1024
+
+// FNV-1a over the font pointer, the color and the text: the key of one cache entry.
+static Uint32 text_cache_hash(TTF_Font *font, const char *text, SDL_Color color) {
+    Uint32 h = 2166136261u;
+    uintptr_t f = (uintptr_t) font;
+    for (size_t i = 0; i < sizeof(f); i++) h = (h ^ (Uint32) ((f >> (i * 8)) & 0xFF)) * 16777619u;
+    h = (h ^ color.r) * 16777619u;
+    h = (h ^ color.g) * 16777619u;
+    h = (h ^ color.b) * 16777619u;
+    h = (h ^ color.a) * 16777619u;
+    for (const unsigned char *c = (const unsigned char *) text; *c; c++) h = (h ^ *c) * 16777619u;
+    return h;
+}
+
+// A text longer than the entry's buffer is kept whole in long_text, so it is cached too and always compared
+// in full.
+static bool text_cache_matches(const TextCacheEntry *entry, Uint32 hash, TTF_Font *font, const char *text,
+                               SDL_Color color) {
+    return entry->hash == hash && entry->font == font && entry->color.r == color.r &&
+           entry->color.g == color.g && entry->color.b == color.b && entry->color.a == color.a &&
+           strcmp(entry->long_text ? entry->long_text : entry->text, text) == 0;
+}
+
+// Unlinks an entry from the recency list (most recent at the head, eviction victim at the tail).
+static void text_cache_lru_unlink(Overlay *o, int index) {
+    TextCacheEntry *entry = &o->text_cache[index];
+    if (entry->lru_prev >= 0) o->text_cache[entry->lru_prev].lru_next = entry->lru_next;
+    else o->text_cache_lru_head = entry->lru_next;
+    if (entry->lru_next >= 0) o->text_cache[entry->lru_next].lru_prev = entry->lru_prev;
+    else o->text_cache_lru_tail = entry->lru_prev;
+    entry->lru_prev = entry->lru_next = -1;
+}
+
+static void text_cache_lru_push_front(Overlay *o, int index) {
+    TextCacheEntry *entry = &o->text_cache[index];
+    entry->lru_prev = -1;
+    entry->lru_next = o->text_cache_lru_head;
+    if (o->text_cache_lru_head >= 0) o->text_cache[o->text_cache_lru_head].lru_prev = index;
+    o->text_cache_lru_head = index;
+    if (o->text_cache_lru_tail < 0) o->text_cache_lru_tail = index;
+}
+
+// Removes an entry from the hash table. Linear probing without tombstones: the entries after the hole
+// are shifted back into it when their probe run passes over it, so every lookup still finds them.
+static void text_cache_table_remove(Overlay *o, int index) {
+    const Uint32 mask = TEXT_CACHE_TABLE_SIZE - 1;
+    Uint32 pos = o->text_cache[index].hash & mask;
+    while (o->text_cache_table[pos] != index) pos = (pos + 1) & mask;
+
+    Uint32 hole = pos;
+    for (Uint32 next = (hole + 1) & mask; o->text_cache_table[next] >= 0; next = (next + 1) & mask) {
+        Uint32 home = o->text_cache[o->text_cache_table[next]].hash & mask;
+        // Movable unless its home lies cyclically within (hole, next]
+        bool stays = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+        if (stays) continue;
+        o->text_cache_table[hole] = o->text_cache_table[next];
+        hole = next;
+    }
+    o->text_cache_table[hole] = -1;
+}
+
+static void text_cache_table_insert(Overlay *o, int index) {
+    const Uint32 mask = TEXT_CACHE_TABLE_SIZE - 1;
+    Uint32 pos = o->text_cache[index].hash & mask;
+    while (o->text_cache_table[pos] >= 0) pos = (pos + 1) & mask;
+    o->text_cache_table[pos] = index;
+}
+
 /**
  * @brief Helper function for text caching to improve performance.
+ * Lookups go through a hash table and evictions take the tail of the recency list, so neither scans
+ * the cache.
  * @param o The Overlay instance
  * @param font The font to render with (top bar and rows may use different sizes)
  * @param text The text to cache
  * @param color The color of the text
  * @return The SDL_Texture of the cached text
  */
-// Upper bound on cached text textures. Volatile strings (the IGT/timer in the top
-// info bar change every frame) would otherwise grow this without limit; once the cap
-// is hit the least-recently-used entry is evicted so memory stays bounded.
-#define MAX_TEXT_CACHE_ENTRIES 512
-
 static SDL_Texture *get_text_texture_from_cache(Overlay *o, TTF_Font *font, const char *text, SDL_Color color) {
     if (!text || text[0] == '\0') {
         return nullptr;
     }
 
-    Uint32 now = SDL_GetTicks();
+    // The entries are allocated once at the cap, so table indices never move.
+    if (!o->text_cache) {
+        o->text_cache = (TextCacheEntry *) calloc(MAX_TEXT_CACHE_ENTRIES, sizeof(TextCacheEntry));
+        o->text_cache_table = (int *) malloc(TEXT_CACHE_TABLE_SIZE * sizeof(int));
+        if (!o->text_cache || !o->text_cache_table) {
+            free(o->text_cache);
+            free(o->text_cache_table);
+            o->text_cache = nullptr;
+            o->text_cache_table = nullptr;
+            return nullptr;
+        }
+        for (int i = 0; i < TEXT_CACHE_TABLE_SIZE; i++) o->text_cache_table[i] = -1;
+        o->text_cache_capacity = MAX_TEXT_CACHE_ENTRIES;
+        o->text_cache_count = 0;
+        o->text_cache_lru_head = o->text_cache_lru_tail = -1;
+    }
 
     // 1. Check if the texture is already in the cache
-    for (int i = 0; i < o->text_cache_count; i++) {
-        TextCacheEntry *entry = &o->text_cache[i];
-        if (entry->font == font && strcmp(entry->text, text) == 0 &&
-            entry->color.r == color.r && entry->color.g == color.g &&
-            entry->color.b == color.b && entry->color.a == color.a) {
-            entry->last_used = now;
-            return entry->texture;
+    Uint32 hash = text_cache_hash(font, text, color);
+    const Uint32 mask = TEXT_CACHE_TABLE_SIZE - 1;
+    for (Uint32 pos = hash & mask; o->text_cache_table[pos] >= 0; pos = (pos + 1) & mask) {
+        int index = o->text_cache_table[pos];
+        if (text_cache_matches(&o->text_cache[index], hash, font, text, color)) {
+            if (o->text_cache_lru_head != index) {
+                text_cache_lru_unlink(o, index);
+                text_cache_lru_push_front(o, index);
+            }
+            profiler_count("text cache hits");
+            return o->text_cache[index].texture;
         }
     }
+    profiler_count("text cache misses");
 
     // 2. If not in cache, create it and add it
     SDL_Surface *text_surface = TTF_RenderText_Blended(font, text, 0, color);
@@ -170,37 +264,41 @@ static SDL_Texture *get_text_texture_from_cache(Overlay *o, TTF_Font *font, cons
     }
     SDL_SetTextureScaleMode(text_texture, SDL_SCALEMODE_NEAREST);
 
-    // 3. Pick a slot: reuse the least-recently-used one at the cap, else append
-    // (growing the array, but never past the cap).
-    TextCacheEntry *slot;
-    if (o->text_cache_count >= MAX_TEXT_CACHE_ENTRIES) {
-        int lru = 0;
-        for (int i = 1; i < o->text_cache_count; i++) {
-            if (o->text_cache[i].last_used < o->text_cache[lru].last_used) lru = i;
+    // A text that doesn't fit the entry's buffer is kept whole, so it can be compared in full
+    char *long_text = nullptr;
+    size_t text_len = strlen(text);
+    if (text_len >= sizeof(o->text_cache[0].text)) {
+        long_text = (char *) malloc(text_len + 1);
+        if (!long_text) {
+            SDL_DestroyTexture(text_texture);
+            return nullptr;
         }
-        if (o->text_cache[lru].texture) SDL_DestroyTexture(o->text_cache[lru].texture);
-        slot = &o->text_cache[lru];
+        memcpy(long_text, text, text_len + 1);
+    }
+
+    // 3. Pick a slot: reuse the least-recently-used one at the cap, else take the next free one.
+    int index;
+    if (o->text_cache_count >= MAX_TEXT_CACHE_ENTRIES) {
+        index = o->text_cache_lru_tail;
+        text_cache_lru_unlink(o, index);
+        text_cache_table_remove(o, index);
+        if (o->text_cache[index].texture) SDL_DestroyTexture(o->text_cache[index].texture);
+        free(o->text_cache[index].long_text);
+        profiler_count("text cache evictions");
     } else {
-        if (o->text_cache_count >= o->text_cache_capacity) {
-            int new_capacity = o->text_cache_capacity == 0 ? 32 : o->text_cache_capacity * 2;
-            if (new_capacity > MAX_TEXT_CACHE_ENTRIES) new_capacity = MAX_TEXT_CACHE_ENTRIES;
-            auto *new_cache = (TextCacheEntry *) realloc(o->text_cache, new_capacity * sizeof(TextCacheEntry));
-            if (!new_cache) {
-                SDL_DestroyTexture(text_texture);
-                return nullptr;
-            }
-            o->text_cache = new_cache;
-            o->text_cache_capacity = new_capacity;
-        }
-        slot = &o->text_cache[o->text_cache_count++];
+        index = o->text_cache_count++;
     }
 
+    TextCacheEntry *slot = &o->text_cache[index];
     strncpy(slot->text, text, sizeof(slot->text) - 1);
     slot->text[sizeof(slot->text) - 1] = '\0';
+    slot->long_text = long_text;
     slot->color = color;
     slot->font = font; // Was previously never stored, so lookups always missed and leaked a texture per frame.
     slot->texture = text_texture;
-    slot->last_used = now;
+    slot->hash = hash;
+    text_cache_table_insert(o, index);
+    text_cache_lru_push_front(o, index);
 
     return slot->texture;
 }
@@ -209,6 +307,182 @@ static inline float snap_px(float v) {
     return roundf(v);
 }
 
+// --- Glyph atlas for volatile text ---------------------------------------
+// Strings that change while the overlay runs (IGT, update timer, live counters) would otherwise be
+// rendered into a new texture and uploaded on every change, churning the text cache. They are drawn
+// from a per-font atlas of printable ASCII instead, as one SDL_RenderGeometry batch per string. Text
+// with any other character (world names, labels) keeps using the text cache.
+
+#define GLYPH_ATLAS_WIDTH 1024
+#define GLYPH_ATLAS_PADDING 1
+
+static bool glyph_atlas_build(Overlay *o, GlyphAtlas *atlas, TTF_Font *font) {
+    atlas->font = font;
+    atlas->texture = nullptr;
+    atlas->line_height = (float) TTF_GetFontHeight(font);
+
+    // Render every glyph first, so the atlas height is known before anything is packed.
+    SDL_Surface *surfaces[GLYPH_ATLAS_CHAR_COUNT] = {};
+    const SDL_Color white = {255, 255, 255, 255};
+    int x = 0, y = 0, row_h = 0;
+    SDL_Rect cells[GLYPH_ATLAS_CHAR_COUNT];
+    bool ok = true;
+    for (int i = 0; i < GLYPH_ATLAS_CHAR_COUNT && ok; i++) {
+        Uint32 ch = (Uint32) (GLYPH_ATLAS_FIRST_CHAR + i);
+        int minx = 0, advance = 0;
+        if (!TTF_GetGlyphMetrics(font, ch, &minx, nullptr, nullptr, nullptr, &advance)) {
+            ok = false;
+            break;
+        }
+        atlas->glyphs[i].advance = (float) advance;
+        atlas->glyphs[i].offset_x = (float) (minx < 0 ? minx : 0);
+        if (ch != ' ') surfaces[i] = TTF_RenderGlyph_Blended(font, ch, white);
+        int w = surfaces[i] ? surfaces[i]->w : 0;
+        int h = surfaces[i] ? surfaces[i]->h : 0;
+        if (x + w + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_WIDTH) {
+            x = 0;
+            y += row_h + GLYPH_ATLAS_PADDING;
+            row_h = 0;
+        }
+        cells[i] = {x, y, w, h};
+        x += w + GLYPH_ATLAS_PADDING;
+        if (h > row_h) row_h = h;
+    }
+
+    SDL_Surface *sheet = ok ? SDL_CreateSurface(GLYPH_ATLAS_WIDTH, y + row_h + 1, SDL_PIXELFORMAT_ARGB8888) : nullptr;
+    if (sheet) {
+        SDL_FillSurfaceRect(sheet, nullptr, 0); // Transparent
+        for (int i = 0; i < GLYPH_ATLAS_CHAR_COUNT; i++) {
+            atlas->glyphs[i].src = {(float) cells[i].x, (float) cells[i].y, (float) cells[i].w, (float) cells[i].h};
+            if (!surfaces[i]) continue;
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE); // Copy the coverage as-is
+            SDL_BlitSurface(surfaces[i], nullptr, sheet, &cells[i]);
+        }
+        atlas->texture = SDL_CreateTextureFromSurface(o->renderer, sheet);
+        if (atlas->texture) SDL_SetTextureScaleMode(atlas->texture, SDL_SCALEMODE_NEAREST);
+        SDL_DestroySurface(sheet);
+    }
+    for (int i = 0; i < GLYPH_ATLAS_CHAR_COUNT; i++) {
+        if (surfaces[i]) SDL_DestroySurface(surfaces[i]);
+    }
+    if (!atlas->texture) {
+        log_message(LOG_ERROR, "[OVERLAY] Failed to build a glyph atlas, volatile text uses the text cache.\n");
+    }
+    return atlas->texture != nullptr;
+}
+
+// The atlas of a font, built on first use. nullptr if it couldn't be built.
+static GlyphAtlas *glyph_atlas_for(Overlay *o, TTF_Font *font) {
+    if (!font) return nullptr;
+    for (int i = 0; i < OVERLAY_GLYPH_ATLAS_COUNT; i++) {
+        GlyphAtlas *atlas = &o->glyph_atlases[i];
+        if (atlas->font == font) return atlas->texture ? atlas : nullptr;
+        if (!atlas->font) return glyph_atlas_build(o, atlas, font) ? atlas : nullptr;
+    }
+    return nullptr; // More fonts than slots
+}
+
+// Size of a string drawn from the atlas, matching what the text cache's texture would measure.
+// Returns false if the text has a character the atlas doesn't hold.
+static bool glyph_atlas_measure(const GlyphAtlas *atlas, const char *text, float *w, float *h) {
+    float pen = 0.0f, right = 0.0f;
+    Uint32 prev = 0;
+    for (const unsigned char *c = (const unsigned char *) text; *c; c++) {
+        if (*c < GLYPH_ATLAS_FIRST_CHAR || *c >= GLYPH_ATLAS_FIRST_CHAR + GLYPH_ATLAS_CHAR_COUNT) return false;
+        int kerning = 0;
+        if (prev && TTF_GetGlyphKerning(atlas->font, prev, *c, &kerning)) pen += (float) kerning;
+        const GlyphAtlasGlyph *g = &atlas->glyphs[*c - GLYPH_ATLAS_FIRST_CHAR];
+        right = fmaxf(right, pen + g->offset_x + g->src.w);
+        pen += g->advance;
+        prev = *c;
+    }
+    *w = fmaxf(pen, right);
+    *h = atlas->line_height;
+    return true;
+}
+
+// Draws a string measured by glyph_atlas_measure with its top-left at (x, y), tinted with color.
+static void glyph_atlas_draw(Overlay *o, const GlyphAtlas *atlas, const char *text, float x, float y, SDL_Color color) {
+    static std::vector<SDL_Vertex> vertices;
+    static std::vector<int> indices;
+    vertices.clear();
+    indices.clear();
+
+    float tex_w = 0.0f, tex_h = 0.0f;
+    SDL_GetTextureSize(atlas->texture, &tex_w, &tex_h);
+    SDL_FColor tint = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    float pen = x;
+    Uint32 prev = 0;
+    for (const unsigned char *c = (const unsigned char *) text; *c; c++) {
+        int kerning = 0;
+        if (prev && TTF_GetGlyphKerning(atlas->font, prev, *c, &kerning)) pen += (float) kerning;
+        prev = *c;
+        const GlyphAtlasGlyph *g = &atlas->glyphs[*c - GLYPH_ATLAS_FIRST_CHAR];
+        if (g->src.w > 0.0f) {
+            float x0 = pen + g->offset_x, y0 = y, x1 = x0 + g->src.w, y1 = y + g->src.h;
+            float u0 = g->src.x / tex_w, v0 = g->src.y / tex_h;
+            float u1 = (g->src.x + g->src.w) / tex_w, v1 = (g->src.y + g->src.h) / tex_h;
+            int base = (int) vertices.size();
+            vertices.push_back({{x0, y0}, tint, {u0, v0}});
+            vertices.push_back({{x1, y0}, tint, {u1, v0}});
+            vertices.push_back({{x1, y1}, tint, {u1, v1}});
+            vertices.push_back({{x0, y1}, tint, {u0, v1}});
+            indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        pen += g->advance;
+    }
+    if (indices.empty()) return;
+    SDL_RenderGeometry(o->renderer, atlas->texture, vertices.data(), (int) vertices.size(), indices.data(),
+                       (int) indices.size());
+    profiler_count("glyph atlas draws");
+}
+
+// Draws volatile text from the font's glyph atlas, falling back to the text cache for characters outside
+// it. align: 0 = x is the left edge, 1 = centered on x, 2 = x is the right edge. Returns the drawn size.
+static SDL_FPoint draw_volatile_text(Overlay *o, TTF_Font *font, const char *text, SDL_Color color, float x, float y,
+                                     int align) {
+    SDL_FPoint size = {0.0f, 0.0f};
+    if (!text || text[0] == '\0') return size;
+    GlyphAtlas *atlas = glyph_atlas_for(o, font);
+    if (atlas && glyph_atlas_measure(atlas, text, &size.x, &size.y)) {
+        float left = align == 1 ? x - size.x / 2.0f : align == 2 ? x - size.x : x;
+        glyph_atlas_draw(o, atlas, text, snap_px(left), snap_px(y), color);
+        return size;
+    }
+    SDL_Texture *texture = get_text_texture_from_cache(o, font, text, color);
+    if (!texture) return size;
+    SDL_GetTextureSize(texture, &size.x, &size.y);
+    float left = align == 1 ? x - size.x / 2.0f : align == 2 ? x - size.x : x;
+    SDL_FRect dest = {left, y, size.x, size.y};
+    SDL_RenderTexture(o->renderer, texture, nullptr, &dest);
+    return size;
+}
+
+// --- Frame scheduling ----------------------------------------------------
+// The overlay loop sleeps between frames while nothing on screen changes by itself (see
+// overlay_next_frame_tick). Whatever is drawn with a life of its own reports when it next needs a
+// frame: continuous motion (scrolling, crop/fade, slides) right away, timed changes (page flips,
+// GIF frames, stat cycling) at the tick they happen. Reset at the start of every overlay_update.
+static Uint64 s_next_frame_tick = UINT64_MAX;
+
+static inline void frame_due_now() {
+    s_next_frame_tick = 0;
+}
+
+static inline void frame_due_at(Uint64 tick) {
+    if (tick < s_next_frame_tick) s_next_frame_tick = tick;
+}
+
+// Schedules a timer that fires once `elapsed` reaches `interval` (both in seconds).
+static inline void frame_due_after(float elapsed, float interval) {
+    float left = interval - elapsed;
+    frame_due_at(SDL_GetTicks() + (left > 0.0f ? (Uint64) (left * 1000.0f) + 1 : 0));
+}
+
+Uint64 overlay_next_frame_tick() {
+    return s_next_frame_tick;
+}
+
 // A row scrolls at its own speed when the per-row custom speed is enabled,
 // otherwise it falls back to the global overlay scroll speed.
 static inline float effective_scroll_speed(bool custom_enabled, float custom_speed, float global_speed) {
@@ -324,6 +598,7 @@ static void belt_update(ScrollBelt &b, float scroll_offset, float iw,
         }
         b.anim_prev = SDL_GetTicks();
         b.init = true;
+        frame_due_now(); // Motion is only seen from the next frame on
     }
 
     // Advance the per-item clear timers and decide which items are fully gone.
@@ -356,6 +631,7 @@ static void belt_update(ScrollBelt &b, float scroll_offset, float iw,
     }
 
     // Move with the scroll, then turn fully-cleared tiles into gaps.
+    if (scroll_offset != b.prev_offset) frame_due_now();
     b.head_x += scroll_offset - b.prev_offset;
     b.prev_offset = scroll_offset;
     for (int &t: b.tiles) {
@@ -425,6 +701,7 @@ static void belt_update(ScrollBelt &b, float scroll_offset, float iw,
         float clear = 0.0f;
         float alpha = 1.0f;
         if (idx >= 0 && removed[idx]) {
+            if (b.clear_elapsed[idx] < duration) frame_due_now(); // Still animating out
             if (crop_duration > 0.0f) {
                 clear = b.clear_elapsed[idx] / crop_duration;
                 if (clear < 0.0f) clear = 0.0f;
@@ -695,6 +972,7 @@ static void page_update(PageView &p, int page_index, OverlayProgressTextAlignmen
         float clear = 0.0f;
         float alpha = 1.0f;
         if (idx >= 0 && removed[idx]) {
+            if (p.clear_elapsed[idx] < duration) frame_due_now(); // Still animating out
             if (crop_duration > 0.0f) {
                 clear = p.clear_elapsed[idx] / crop_duration;
                 if (clear < 0.0f) clear = 0.0f;
@@ -712,6 +990,25 @@ static void page_update(PageView &p, int page_index, OverlayProgressTextAlignmen
     }
 }
 
+// Returns the animated texture's current frame based on the elapsed time, and schedules the frame for
+// when the next one is due. Also used so a .gif panel can be 9-sliced frame by frame.
+static SDL_Texture *anim_current_frame(AnimatedTexture *anim) {
+    if (!anim || anim->frame_count <= 0) return nullptr;
+    if (anim->delays && anim->total_duration > 0 && anim->frame_count > 1) {
+        Uint64 now = SDL_GetTicks();
+        Uint32 elapsed = (Uint32) (now % anim->total_duration);
+        Uint32 sum = 0;
+        for (int i = 0; i < anim->frame_count; ++i) {
+            sum += anim->delays[i];
+            if (elapsed < sum) {
+                frame_due_at(now + (sum - elapsed));
+                return anim->frames[i];
+            }
+        }
+    }
+    return anim->frames[0];
+}
+
 /** @brief Helper function to render a texture (static or animated) with alpha modulation
  * It also corrects the aspect ratio of the .png textures.
  *
@@ -729,21 +1026,7 @@ static void render_texture_with_alpha(SDL_Renderer *renderer, SDL_Texture *textu
 
     if (anim_texture && anim_texture->frame_count > 0) {
         is_animated = true;
-        if (anim_texture->delays && anim_texture->total_duration > 0) {
-            Uint32 elapsed_time = SDL_GetTicks() % anim_texture->total_duration;
-            int current_frame = 0;
-            Uint32 time_sum = 0;
-            for (int frame_idx = 0; frame_idx < anim_texture->frame_count; ++frame_idx) {
-                time_sum += anim_texture->delays[frame_idx];
-                if (elapsed_time < time_sum) {
-                    current_frame = frame_idx;
-                    break;
-                }
-            }
-            texture_to_render = anim_texture->frames[current_frame];
-        } else {
-            texture_to_render = anim_texture->frames[0];
-        }
+        texture_to_render = anim_current_frame(anim_texture);
     } else if (texture) {
         texture_to_render = texture;
     }
@@ -784,19 +1067,264 @@ static void render_texture_with_alpha(SDL_Renderer *renderer, SDL_Texture *textu
 }
 
 
-// Returns the animated texture's current frame based on the elapsed time, mirroring the frame
-// selection in render_texture_with_alpha. Used so a .gif panel can be 9-sliced frame by frame.
-static SDL_Texture *anim_current_frame(AnimatedTexture *anim) {
-    if (!anim || anim->frame_count <= 0) return nullptr;
-    if (anim->delays && anim->total_duration > 0) {
-        Uint32 elapsed = SDL_GetTicks() % anim->total_duration;
-        Uint32 sum = 0;
-        for (int i = 0; i < anim->frame_count; ++i) {
-            sum += anim->delays[i];
-            if (elapsed < sum) return anim->frames[i];
+// --- Icon atlas and batched row drawing --------------------------------------
+// Every icon and item background used to be its own SDL_RenderTexture, so a full belt cost
+// thousands of draw calls a frame. Static textures from the overlay's texture cache (icons and
+// the adv_bg* backgrounds) are copied into shared atlas pages the first time they're drawn, and
+// each row queues its quads in a DrawBatch that submits one SDL_RenderGeometry per run of quads
+// sharing a texture. The fade animation travels as per-vertex alpha, and the crop animation's
+// clip rect is applied to the quad geometry, so neither forces a flush. .gif frames aren't atlased
+// (they'd need every frame packed) and only break the batch where they appear.
+
+#define ICON_ATLAS_PAGE_SIZE 2048
+#define ICON_ATLAS_MAX_PAGES 4
+#define ICON_ATLAS_MAX_ICON 256 // Larger textures are drawn from their own texture
+#define ICON_ATLAS_PADDING 1
+
+struct IconAtlasEntry {
+    int page; // -1 = not atlased, drawn from the source texture
+    SDL_FRect src; // Pixel rect in the page
+};
+
+struct IconAtlas {
+    std::vector<SDL_Texture *> pages;
+    std::unordered_map<SDL_Texture *, IconAtlasEntry> entries; // Keyed by the cache-owned source texture
+    int shelf_x, shelf_y, shelf_h; // Packing cursor in the last page
+};
+
+static IconAtlas s_icon_atlas;
+
+// Drops all pages, e.g. when the renderer lost its render targets. Icons are re-packed on next use.
+static void icon_atlas_free() {
+    for (SDL_Texture *page: s_icon_atlas.pages) SDL_DestroyTexture(page);
+    s_icon_atlas.pages.clear();
+    s_icon_atlas.entries.clear();
+    s_icon_atlas.shelf_x = s_icon_atlas.shelf_y = s_icon_atlas.shelf_h = 0;
+}
+
+static SDL_Texture *icon_atlas_add_page(SDL_Renderer *r) {
+    if ((int) s_icon_atlas.pages.size() >= ICON_ATLAS_MAX_PAGES) return nullptr;
+    SDL_Texture *page = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                          ICON_ATLAS_PAGE_SIZE, ICON_ATLAS_PAGE_SIZE);
+    if (!page) {
+        log_message(LOG_ERROR, "[OVERLAY] Failed to create an icon atlas page: %s\n", SDL_GetError());
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(page, SDL_SCALEMODE_NEAREST);
+
+    SDL_Texture *prev_target = SDL_GetRenderTarget(r);
+    Uint8 cr, cg, cb, ca;
+    SDL_GetRenderDrawColor(r, &cr, &cg, &cb, &ca);
+    SDL_SetRenderTarget(r, page);
+    SDL_SetRenderDrawColor(r, 0, 0, 0, 0);
+    SDL_RenderClear(r);
+    SDL_SetRenderDrawColor(r, cr, cg, cb, ca);
+    SDL_SetRenderTarget(r, prev_target);
+
+    s_icon_atlas.pages.push_back(page);
+    s_icon_atlas.shelf_x = s_icon_atlas.shelf_y = s_icon_atlas.shelf_h = 0;
+    return page;
+}
+
+// Finds (packing it on first use) the atlas copy of a static texture. Returns the texture to draw
+// from and sets src to the pixel rect within it; the source texture itself if it can't be atlased.
+static SDL_Texture *icon_atlas_lookup(SDL_Renderer *r, SDL_Texture *tex, SDL_FRect *src) {
+    auto it = s_icon_atlas.entries.find(tex);
+    if (it == s_icon_atlas.entries.end()) {
+        IconAtlasEntry entry = {-1, {}};
+        float fw = 0.0f, fh = 0.0f;
+        SDL_ScaleMode mode = SDL_SCALEMODE_NEAREST;
+        SDL_GetTextureSize(tex, &fw, &fh);
+        SDL_GetTextureScaleMode(tex, &mode);
+        int w = (int) fw, h = (int) fh;
+        if (w > 0 && h > 0 && w <= ICON_ATLAS_MAX_ICON && h <= ICON_ATLAS_MAX_ICON && mode == SDL_SCALEMODE_NEAREST) {
+            // Shelf packing: left to right, a new shelf when the row is full, a new page when the page is.
+            if (!s_icon_atlas.pages.empty() && s_icon_atlas.shelf_x + w > ICON_ATLAS_PAGE_SIZE) {
+                s_icon_atlas.shelf_x = 0;
+                s_icon_atlas.shelf_y += s_icon_atlas.shelf_h + ICON_ATLAS_PADDING;
+                s_icon_atlas.shelf_h = 0;
+            }
+            SDL_Texture *page = nullptr;
+            if (!s_icon_atlas.pages.empty() && s_icon_atlas.shelf_y + h <= ICON_ATLAS_PAGE_SIZE) {
+                page = s_icon_atlas.pages.back();
+            } else {
+                page = icon_atlas_add_page(r);
+            }
+            if (page) {
+                entry.page = (int) s_icon_atlas.pages.size() - 1;
+                entry.src = {(float) s_icon_atlas.shelf_x, (float) s_icon_atlas.shelf_y, (float) w, (float) h};
+                s_icon_atlas.shelf_x += w + ICON_ATLAS_PADDING;
+                if (h > s_icon_atlas.shelf_h) s_icon_atlas.shelf_h = h;
+
+                // Copy the pixels as they are (no blending into the cleared page, full alpha mod).
+                SDL_BlendMode prev_blend = SDL_BLENDMODE_BLEND;
+                SDL_GetTextureBlendMode(tex, &prev_blend);
+                SDL_Texture *prev_target = SDL_GetRenderTarget(r);
+                SDL_SetRenderTarget(r, page);
+                SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_NONE);
+                SDL_SetTextureAlphaMod(tex, 255);
+                SDL_SetTextureColorMod(tex, 255, 255, 255);
+                SDL_RenderTexture(r, tex, nullptr, &entry.src);
+                SDL_SetTextureBlendMode(tex, prev_blend);
+                SDL_SetRenderTarget(r, prev_target);
+                profiler_count("icon atlas packs");
+            }
         }
+        it = s_icon_atlas.entries.emplace(tex, entry).first;
     }
-    return anim->frames[0];
+
+    if (it->second.page < 0) {
+        float w = 0.0f, h = 0.0f;
+        SDL_GetTextureSize(tex, &w, &h);
+        *src = {0.0f, 0.0f, w, h};
+        return tex;
+    }
+    *src = it->second.src;
+    return s_icon_atlas.pages[it->second.page];
+}
+
+// Quads of one row waiting to be submitted, plus the row's totals for the profiler.
+struct DrawBatch {
+    const char *calls_counter; // Profiler labels (static strings)
+    const char *vertices_counter;
+    SDL_Texture *texture; // Texture of the pending quads
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    int draw_calls;
+    int vertex_count;
+};
+
+static void draw_batch_begin(DrawBatch &b, const char *calls_counter, const char *vertices_counter) {
+    b.calls_counter = calls_counter;
+    b.vertices_counter = vertices_counter;
+    b.texture = nullptr;
+    b.vertices.clear();
+    b.indices.clear();
+    b.draw_calls = 0;
+    b.vertex_count = 0;
+}
+
+// Submits the pending quads. Their crop clip is already baked into the geometry, so the renderer
+// clip (set for whichever tile is current) is lifted while they're drawn.
+static void draw_batch_flush(SDL_Renderer *r, DrawBatch &b) {
+    if (b.indices.empty()) return;
+    bool clipped = SDL_RenderClipEnabled(r);
+    SDL_Rect clip = {};
+    if (clipped) {
+        SDL_GetRenderClipRect(r, &clip);
+        SDL_SetRenderClipRect(r, nullptr);
+    }
+    SDL_RenderGeometry(r, b.texture, b.vertices.data(), (int) b.vertices.size(), b.indices.data(),
+                       (int) b.indices.size());
+    if (clipped) SDL_SetRenderClipRect(r, &clip);
+    b.draw_calls++;
+    b.vertex_count += (int) b.vertices.size();
+    b.vertices.clear();
+    b.indices.clear();
+}
+
+// Flushes the rest of the row and reports its draw calls and vertices.
+static void draw_batch_end(SDL_Renderer *r, DrawBatch &b) {
+    draw_batch_flush(r, b);
+    profiler_count_n(b.calls_counter, b.draw_calls);
+    profiler_count_n(b.vertices_counter, b.vertex_count);
+}
+
+// Queues src (pixels of tex) drawn to dest, cut to the renderer's current clip rect.
+static void draw_batch_quad(SDL_Renderer *r, DrawBatch &b, SDL_Texture *tex, const SDL_FRect &src,
+                            SDL_FRect dest, Uint8 alpha) {
+    if (dest.w <= 0.0f || dest.h <= 0.0f || alpha == 0) return;
+    float tex_w = 0.0f, tex_h = 0.0f;
+    SDL_GetTextureSize(tex, &tex_w, &tex_h);
+    if (tex_w <= 0.0f || tex_h <= 0.0f) return;
+
+    float u0 = src.x / tex_w, v0 = src.y / tex_h;
+    float u1 = (src.x + src.w) / tex_w, v1 = (src.y + src.h) / tex_h;
+    if (SDL_RenderClipEnabled(r)) {
+        SDL_Rect clip;
+        SDL_GetRenderClipRect(r, &clip);
+        float cx0 = fmaxf(dest.x, (float) clip.x), cx1 = fminf(dest.x + dest.w, (float) (clip.x + clip.w));
+        float cy0 = fmaxf(dest.y, (float) clip.y), cy1 = fminf(dest.y + dest.h, (float) (clip.y + clip.h));
+        if (cx1 <= cx0 || cy1 <= cy0) return;
+        float du = (u1 - u0) / dest.w, dv = (v1 - v0) / dest.h;
+        u1 = u0 + (cx1 - dest.x) * du;
+        u0 += (cx0 - dest.x) * du;
+        v1 = v0 + (cy1 - dest.y) * dv;
+        v0 += (cy0 - dest.y) * dv;
+        dest = {cx0, cy0, cx1 - cx0, cy1 - cy0};
+    }
+
+    if (tex != b.texture) {
+        draw_batch_flush(r, b);
+        b.texture = tex;
+    }
+    SDL_FColor color = {1.0f, 1.0f, 1.0f, alpha / 255.0f};
+    int base = (int) b.vertices.size();
+    b.vertices.push_back({{dest.x, dest.y}, color, {u0, v0}});
+    b.vertices.push_back({{dest.x + dest.w, dest.y}, color, {u1, v0}});
+    b.vertices.push_back({{dest.x + dest.w, dest.y + dest.h}, color, {u1, v1}});
+    b.vertices.push_back({{dest.x, dest.y + dest.h}, color, {u0, v1}});
+    b.indices.insert(b.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+// Queues an untextured rectangle (the missing-icon placeholder) so it keeps its place among the
+// row's icons, cut to the renderer's current clip rect like draw_batch_quad.
+static void draw_batch_fill(SDL_Renderer *r, DrawBatch &b, SDL_FRect dest, SDL_Color color) {
+    if (dest.w <= 0.0f || dest.h <= 0.0f || color.a == 0) return;
+    if (SDL_RenderClipEnabled(r)) {
+        SDL_Rect clip;
+        SDL_GetRenderClipRect(r, &clip);
+        float cx0 = fmaxf(dest.x, (float) clip.x), cx1 = fminf(dest.x + dest.w, (float) (clip.x + clip.w));
+        float cy0 = fmaxf(dest.y, (float) clip.y), cy1 = fminf(dest.y + dest.h, (float) (clip.y + clip.h));
+        if (cx1 <= cx0 || cy1 <= cy0) return;
+        dest = {cx0, cy0, cx1 - cx0, cy1 - cy0};
+    }
+
+    if (b.texture != nullptr) {
+        draw_batch_flush(r, b);
+        b.texture = nullptr;
+    }
+    SDL_FColor fcolor = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    int base = (int) b.vertices.size();
+    b.vertices.push_back({{dest.x, dest.y}, fcolor, {0.0f, 0.0f}});
+    b.vertices.push_back({{dest.x + dest.w, dest.y}, fcolor, {0.0f, 0.0f}});
+    b.vertices.push_back({{dest.x + dest.w, dest.y + dest.h}, fcolor, {0.0f, 0.0f}});
+    b.vertices.push_back({{dest.x, dest.y + dest.h}, fcolor, {0.0f, 0.0f}});
+    b.indices.insert(b.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+// Batched render_texture_with_alpha: same frame selection and aspect correction, but queued into
+// the row's batch, from the icon atlas when the texture is static.
+static void draw_batch_texture(SDL_Renderer *r, DrawBatch &b, SDL_Texture *texture, AnimatedTexture *anim_texture,
+                               const SDL_FRect *dest, Uint8 alpha) {
+    if (anim_texture && anim_texture->frame_count > 0) {
+        SDL_Texture *frame = anim_current_frame(anim_texture);
+        if (!frame) return;
+        float w = 0.0f, h = 0.0f;
+        SDL_GetTextureSize(frame, &w, &h);
+        draw_batch_quad(r, b, frame, {0.0f, 0.0f, w, h}, *dest, alpha); // Pre-padded to square at load
+        return;
+    }
+    if (!texture) return;
+
+    SDL_FRect src;
+    SDL_Texture *source = icon_atlas_lookup(r, texture, &src);
+    float scale_factor = fminf(dest->w / src.w, dest->h / src.h);
+    float scaled_w = src.w * scale_factor;
+    float scaled_h = src.h * scale_factor;
+    float pad_x = snap_px((dest->w - scaled_w) / 2.0f);
+    float pad_y = snap_px((dest->h - scaled_h) / 2.0f);
+    draw_batch_quad(r, b, source, src, {dest->x + pad_x, dest->y + pad_y, scaled_w, scaled_h}, alpha);
+}
+
+// Text is drawn right away rather than queued: it sits below the icon band and never overlaps the
+// queued quads, so only the row's draw-call totals need to know about it.
+static void draw_batch_text(SDL_Renderer *r, DrawBatch &b, SDL_Texture *tex, const SDL_FRect *dest, Uint8 alpha) {
+    if (!tex) return;
+    render_text_with_alpha(r, tex, dest, alpha);
+    b.draw_calls++;
+    b.vertex_count += 4;
 }
 
 // Draws a 9-slice (9-patch) texture stretched to `dest`. The four inset x inset source
@@ -845,6 +1373,9 @@ static void draw_nine_slice(SDL_Renderer *r, SDL_Texture *tex, const SDL_FRect *
     SDL_SetTextureColorMod(tex, 255, 255, 255);
     SDL_SetTextureAlphaMod(tex, 255);
 
+    // All nine slices share the texture, so they go out as one geometry call.
+    static DrawBatch batch;
+    draw_batch_begin(batch, "panel draw calls", "panel vertices");
     struct {
         SDL_FRect s, d;
     } quads[9] = {
@@ -860,8 +1391,9 @@ static void draw_nine_slice(SDL_Renderer *r, SDL_Texture *tex, const SDL_FRect *
             };
     for (int i = 0; i < 9; i++) {
         if (quads[i].s.w <= 0.0f || quads[i].s.h <= 0.0f || quads[i].d.w <= 0.0f || quads[i].d.h <= 0.0f) continue;
-        SDL_RenderTexture(r, tex, &quads[i].s, &quads[i].d);
+        draw_batch_quad(r, batch, tex, quads[i].s, quads[i].d, 255);
     }
+    draw_batch_end(r, batch);
 }
 
 // One entry in the Compact panel's cycle: a display label (a section name like "Advancements" or an
@@ -1786,6 +2318,8 @@ static void compact_render_stack(Overlay *o, const Tracker *t, const AppSettings
     }
 
     if (eng.groups.empty()) return;
+    // Holds count down with a clamped dt, so the stack keeps the frame rate until it has drained
+    frame_due_now();
 
     // Layout: settle groups top-to-bottom from stack_top; a fresh group starts hidden behind the
     // panel bottom and slides down into place. Removal is instant unless the fade is on, in which
@@ -2179,6 +2713,7 @@ static void compact_render_promo_line(Overlay *o, const Tracker *t, const AppSet
             if (p.pops[i].hold_left <= 0.0f) p.pops.erase(p.pops.begin() + i);
         }
         while ((int) p.pops.size() > supporter_rows) p.pops.pop_back(); // overflow: cut the oldest
+        frame_due_now(); // The showcase keeps popping supporters in for the rest of the run
     }
 
     // A popping goal owns the promo's slot; the promo waits for the stack to drain, then slides in.
@@ -2217,6 +2752,7 @@ static void compact_render_promo_line(Overlay *o, const Tracker *t, const AppSet
     }
     float rise_f = (rise <= 0.0f) ? 1.0f : fminf(1.0f, dt / rise);
     p.appear_y += (stack_top - p.appear_y) * rise_f;
+    if (fabsf(stack_top - p.appear_y) >= 0.5f) frame_due_now(); // Still sliding in
     float promo_y = snap_px(p.appear_y);
     float slide = promo_y - stack_top; // <= 0 while sliding in, 0 once settled
     int reveal_w = 0, reveal_h = 0;
@@ -2249,6 +2785,7 @@ static void compact_render_promo_line(Overlay *o, const Tracker *t, const AppSet
         // Only a line too long for the band moves: it scrolls until its right edge shows, rests, comes
         // back until its left edge shows, rests, and so on, so all of a long URL can be read.
         float overflow = tw - band_w;
+        if (overflow > 0.0f) frame_due_now();
         if (overflow <= 0.0f) {
             p.scroll_x = 0.0f;
             p.dir = -1.0f;
@@ -2459,9 +2996,14 @@ static void overlay_render_compact(Overlay *o, const Tracker *t, const AppSettin
     }
 
     SDL_Texture *label_tex = get_text_texture_from_cache(o, label_font, label_buf, text_color);
-    SDL_Texture *count_tex = get_text_texture_from_cache(o, count_font, count_buf, text_color);
-
+    // The count (live IGT, progress) changes constantly, so it's drawn from the glyph atlas when it can be.
     float lw = 0.0f, lh = 0.0f, cw = 0.0f, ch = 0.0f;
+    GlyphAtlas *count_atlas = glyph_atlas_for(o, count_font);
+    bool count_from_atlas = count_atlas && glyph_atlas_measure(count_atlas, count_buf, &cw, &ch);
+    SDL_Texture *count_tex = count_from_atlas
+                                 ? nullptr
+                                 : get_text_texture_from_cache(o, count_font, count_buf, text_color);
+
     if (label_tex) SDL_GetTextureSize(label_tex, &lw, &lh);
     if (count_tex) SDL_GetTextureSize(count_tex, &cw, &ch);
 
@@ -2552,7 +3094,10 @@ static void overlay_render_compact(Overlay *o, const Tracker *t, const AppSettin
         SDL_RenderTexture(o->renderer, label_tex, nullptr, &d);
     }
     // The whole count line (completion marker included) is centered as one block.
-    if (count_tex) {
+    if (count_from_atlas && count_buf[0] != '\0') {
+        glyph_atlas_draw(o, count_atlas, count_buf, snap_px(panel_x + (panel_w - cw) / 2.0f),
+                         snap_px(content_top + lh + line_gap), text_color);
+    } else if (count_tex) {
         SDL_FRect d = {snap_px(panel_x + (panel_w - cw) / 2.0f), snap_px(content_top + lh + line_gap), cw, ch};
         SDL_RenderTexture(o->renderer, count_tex, nullptr, &d);
     }
@@ -2949,6 +3494,12 @@ void overlay_events(Overlay *o, SDL_Event *event, bool *is_running, float *delta
             }
             break;
         }
+        // Render-target textures (the icon atlas pages) lose their contents when the
+        // renderer resets its targets (e.g. Direct3D), so drop them and re-pack lazily.
+        case SDL_EVENT_RENDER_TARGETS_RESET:
+            icon_atlas_free();
+            frame_due_now();
+            break;
         default: break;
     }
 }
@@ -3060,6 +3611,7 @@ static bool is_display_item_done(const OverlayDisplayItem &display_item, const A
 }
 
 void overlay_update(Overlay *o, float *deltaTime, const Tracker *t, const AppSettings *settings) {
+    s_next_frame_tick = UINT64_MAX; // Re-collected by this update and the render that follows
     if (!t || !t->template_data) return;
 
     // Store the current delta time so we can display it in the render function.
@@ -3192,6 +3744,7 @@ void overlay_update(Overlay *o, float *deltaTime, const Tracker *t, const AppSet
         o->social_media_timer -= SOCIAL_CYCLE_SECONDS;
         o->current_social_index = (o->current_social_index + 1) % NUM_SOCIALS;
     }
+    frame_due_after(o->social_media_timer, SOCIAL_CYCLE_SECONDS);
 
     // --- Page/Compact mode: advance the shared page index on its own interval ---
     // SPACE advances it directly (see overlay_events), so this only handles the
@@ -3211,6 +3764,7 @@ void overlay_update(Overlay *o, float *deltaTime, const Tracker *t, const AppSet
             o->page_timer -= iv;
             o->page_index++;
         }
+        frame_due_after(o->page_timer, iv);
     } else {
         o->page_timer = 0.0f;
     }
@@ -3225,6 +3779,7 @@ void overlay_update(Overlay *o, float *deltaTime, const Tracker *t, const AppSet
             o->compact_icon_page_timer -= icon_iv;
             o->compact_icon_page_index++;
         }
+        frame_due_after(o->compact_icon_page_timer, icon_iv);
     } else {
         o->compact_icon_page_timer = 0.0f;
     }
@@ -3374,21 +3929,16 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
             settings->overlay_text_color.a
         };
 
-        // Use text cache for top info bar
-        SDL_Texture *text_texture = get_text_texture_from_cache(o, o->font_top, final_buffer, text_color);
-        if (text_texture) {
-            float w, h;
-            SDL_GetTextureSize(text_texture, &w, &h);
-            int overlay_w;
-            SDL_GetWindowSize(o->window, &overlay_w, nullptr);
-            const float padding = 10.0f;
-            SDL_FRect dest_rect = {padding, padding, w, h};
-            if (settings->overlay_progress_text_align == OVERLAY_PROGRESS_TEXT_ALIGN_CENTER)
-                dest_rect.x = ((float) overlay_w - w) / 2.0f;
-            else if (settings->overlay_progress_text_align == OVERLAY_PROGRESS_TEXT_ALIGN_RIGHT)
-                dest_rect.x = (float) overlay_w - w - padding;
-            SDL_RenderTexture(o->renderer, text_texture, nullptr, &dest_rect);
-        }
+        // The info bar changes every second (IGT, update timer), so it's drawn from the glyph atlas
+        int overlay_w;
+        SDL_GetWindowSize(o->window, &overlay_w, nullptr);
+        const float padding = 10.0f;
+        if (settings->overlay_progress_text_align == OVERLAY_PROGRESS_TEXT_ALIGN_CENTER)
+            draw_volatile_text(o, o->font_top, final_buffer, text_color, (float) overlay_w / 2.0f, padding, 1);
+        else if (settings->overlay_progress_text_align == OVERLAY_PROGRESS_TEXT_ALIGN_RIGHT)
+            draw_volatile_text(o, o->font_top, final_buffer, text_color, (float) overlay_w - padding, padding, 2);
+        else
+            draw_volatile_text(o, o->font_top, final_buffer, text_color, padding, padding, 0);
     }
 
     if (!t || !t->template_data) {
@@ -3421,6 +3971,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
         const float ROW1_ICON_SIZE = 48.0f;
         const float ROW1_SHARED_ICON_SIZE = settings->overlay_row1_shared_icon_size; // Originally 30.0f
         const float item_full_width = snap_px(ROW1_ICON_SIZE + settings->overlay_row1_spacing);
+        static DrawBatch row1_batch;
+        draw_batch_begin(row1_batch, "row 1 draw calls", "row 1 vertices");
 
         // Gather items, then build the removal mask (cleared items become gaps) and a
         // signature so the belt resets only when the template itself changes.
@@ -3479,10 +4031,10 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                 }
 
                 if (!tex && !anim_tex) {
-                    SDL_SetRenderDrawColor(o->renderer, 255, 0, 255, (Uint8) (100 * tile_alpha / 255));
-                    SDL_RenderFillRect(o->renderer, &dest_rect);
+                    draw_batch_fill(o->renderer, row1_batch, dest_rect,
+                                    {255, 0, 255, (Uint8) (100 * tile_alpha / 255)});
                 } else {
-                    render_texture_with_alpha(o->renderer, tex, anim_tex, &dest_rect, tile_alpha);
+                    draw_batch_texture(o->renderer, row1_batch, tex, anim_tex, &dest_rect, tile_alpha);
                 }
 
                 // --- Render Shared Parent Icon Overlay ---
@@ -3503,13 +4055,14 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                     SDL_FRect shared_dest_rect = {
                         x_pos, ROW1_Y_POS, ROW1_SHARED_ICON_SIZE, ROW1_SHARED_ICON_SIZE
                     };
-                    render_texture_with_alpha(o->renderer, parent_tex, parent_anim_tex, &shared_dest_rect,
-                                              tile_alpha);
+                    draw_batch_texture(o->renderer, row1_batch, parent_tex, parent_anim_tex, &shared_dest_rect,
+                                       tile_alpha);
                 }
 
                 if (clipped) SDL_SetRenderClipRect(o->renderer, nullptr);
             }
         }
+        draw_batch_end(o->renderer, row1_batch);
     }
 
     // --- ROW 2: Advancements & Unlocks (AND forced items) ---
@@ -3519,6 +4072,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
         const float ITEM_WIDTH = 96.0f; // Minimum Width based on icon bg
         const float ITEM_SPACING = 16.0f;
         const float TEXT_Y_OFFSET = 4.0f;
+        static DrawBatch row2_batch;
+        draw_batch_begin(row2_batch, "row 2 draw calls", "row 2 vertices");
 
         // Static variables to store the randomized supporter list and track completion state
         static std::vector<SupporterRenderInfo> static_supporter_render_list;
@@ -3594,8 +4149,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                 // Render background
                 float bg_x_offset = snap_px((cell_width - ITEM_WIDTH) / 2.0f);
                 SDL_FRect bg_rect = {current_x + bg_x_offset, ROW2_Y_POS, ITEM_WIDTH, ITEM_WIDTH};
-                render_texture_with_alpha(o->renderer, render_info.background_static, render_info.background_anim,
-                                          &bg_rect, 255);
+                draw_batch_texture(o->renderer, row2_batch, render_info.background_static,
+                                   render_info.background_anim, &bg_rect, 255);
 
                 // Render icon
                 SDL_FRect icon_rect = {
@@ -3622,11 +4177,10 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
 
                 if (tex || anim_tex) {
                     // Pass both pointers; the function will correctly choose which one to use
-                    render_texture_with_alpha(o->renderer, tex, anim_tex, &icon_rect, 255);
+                    draw_batch_texture(o->renderer, row2_batch, tex, anim_tex, &icon_rect, 255);
                 } else {
                     // If texture loading fails for any reason, draw a placeholder
-                    SDL_SetRenderDrawColor(o->renderer, 255, 0, 255, 255); // Bright Pink
-                    SDL_RenderFillRect(o->renderer, &icon_rect);
+                    draw_batch_fill(o->renderer, row2_batch, icon_rect, {255, 0, 255, 255}); // Bright Pink
                 }
 
                 // Render name
@@ -3637,7 +4191,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                     SDL_GetTextureSize(name_tex, &w, &h);
                     float text_x = current_x + snap_px((cell_width - w) / 2.0f);
                     SDL_FRect dest_rect = {text_x, ROW2_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET, w, h};
-                    SDL_RenderTexture(o->renderer, name_tex, nullptr, &dest_rect);
+                    draw_batch_text(o->renderer, row2_batch, name_tex, &dest_rect, 255);
 
                     // Render amount
                     char amount_buf[64];
@@ -3648,7 +4202,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                         SDL_GetTextureSize(amount_tex, &pw, &ph);
                         float p_text_x = current_x + snap_px((cell_width - pw) / 2.0f);
                         SDL_FRect p_dest_rect = {p_text_x, ROW2_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET + h, pw, ph};
-                        SDL_RenderTexture(o->renderer, amount_tex, nullptr, &p_dest_rect);
+                        draw_batch_text(o->renderer, row2_batch, amount_tex, &p_dest_rect, 255);
                     }
                 }
             };
@@ -3672,6 +4226,9 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
             } else {
                 float total_row_width = NUM_SUPPORTERS * item_full_width;
                 float start_pos = snap_px(fmod(o->scroll_offset_row2, total_row_width)); // Sync with row 2's speed
+                if (effective_scroll_speed(settings->overlay_row2_custom_scroll_speed_enabled,
+                                           settings->overlay_row2_scroll_speed, settings->overlay_scroll_speed) != 0.0f)
+                    frame_due_now();
                 int blocks_to_draw = (total_row_width > 0) ? (int) ceil((float) window_w / total_row_width) + 2 : 0;
 
                 for (int block = -blocks_to_draw; block <= blocks_to_draw; ++block) {
@@ -4025,6 +4582,9 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                         Uint32 current_ticks = SDL_GetTicks();
                                         int num_incomplete = incomplete_indices.size();
                                         int list_index_to_show = (current_ticks / cycle_duration_ms) % num_incomplete;
+                                        if (num_incomplete > 1)
+                                            frame_due_at(((Uint64) current_ticks / cycle_duration_ms + 1) *
+                                                         cycle_duration_ms);
                                         int original_crit_index = incomplete_indices[list_index_to_show];
                                         TrackableItem *crit = stat->criteria[original_crit_index];
                                         if (crit->goal > 0) {
@@ -4127,7 +4687,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                         }
 
                         SDL_FRect bg_rect = {current_x + bg_x_offset, ROW2_Y_POS, ITEM_WIDTH, ITEM_WIDTH};
-                        render_texture_with_alpha(o->renderer, static_bg, anim_bg, &bg_rect, tile_alpha);
+                        draw_batch_texture(o->renderer, row2_batch, static_bg, anim_bg, &bg_rect, tile_alpha);
 
                         SDL_FRect icon_rect = {
                             bg_rect.x + settings->adv_icon_offset_x, bg_rect.y + settings->adv_icon_offset_y,
@@ -4145,7 +4705,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                                          &o->texture_cache_capacity, icon_path.c_str(),
                                                          SDL_SCALEMODE_NEAREST);
                         }
-                        render_texture_with_alpha(o->renderer, tex, anim_tex, &icon_rect, tile_alpha);
+                        draw_batch_texture(o->renderer, row2_batch, tex, anim_tex, &icon_rect, tile_alpha);
 
                         SDL_Texture *name_texture = get_text_texture_from_cache(o, o->font, name_buf, text_color);
                         if (name_texture) {
@@ -4153,7 +4713,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                             SDL_GetTextureSize(name_texture, &w, &h);
                             float text_x = current_x + snap_px((cell_width_row2 - w) / 2.0f);
                             SDL_FRect dest_rect = {text_x, ROW2_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET, w, h};
-                            render_text_with_alpha(o->renderer, name_texture, &dest_rect, tile_alpha);
+                            draw_batch_text(o->renderer, row2_batch, name_texture, &dest_rect, tile_alpha);
 
                             if (progress_buf[0] != '\0') {
                                 SDL_Texture *progress_texture =
@@ -4165,7 +4725,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                     SDL_FRect p_dest_rect = {
                                         p_text_x, ROW2_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET + h, pw, ph
                                     };
-                                    render_text_with_alpha(o->renderer, progress_texture, &p_dest_rect, tile_alpha);
+                                    draw_batch_text(o->renderer, row2_batch, progress_texture, &p_dest_rect,
+                                                    tile_alpha);
                                 }
                             }
                         }
@@ -4176,6 +4737,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
             }
         }
 
+        draw_batch_end(o->renderer, row2_batch);
+
         // Update the state for the next frame
         run_was_complete_last_frame = is_run_complete;
     }
@@ -4187,6 +4750,8 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
         const float ITEM_WIDTH = 96.0f; // Minimum width based on icon bg
         const float ITEM_SPACING = 16.0f;
         const float TEXT_Y_OFFSET = 4.0f;
+        static DrawBatch row3_batch;
+        draw_batch_begin(row3_batch, "row 3 draw calls", "row 3 vertices");
 
         // Gather items for this row
         std::vector<OverlayDisplayItem> row3_items;
@@ -4530,6 +5095,9 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                     Uint32 current_ticks = SDL_GetTicks();
                                     int num_incomplete = incomplete_indices.size();
                                     int list_index_to_show = (current_ticks / cycle_duration_ms) % num_incomplete;
+                                    if (num_incomplete > 1)
+                                        frame_due_at(((Uint64) current_ticks / cycle_duration_ms + 1) *
+                                                     cycle_duration_ms);
                                     int original_crit_index = incomplete_indices[list_index_to_show];
                                     TrackableItem *crit = stat->criteria[original_crit_index];
 
@@ -4643,7 +5211,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
 
                     // --- Make sure text positioning uses cell_width_row3 for centering ---
                     SDL_FRect bg_rect = {current_x + bg_x_offset, ROW3_Y_POS, ITEM_WIDTH, ITEM_WIDTH};
-                    render_texture_with_alpha(o->renderer, static_bg, anim_bg, &bg_rect, tile_alpha);
+                    draw_batch_texture(o->renderer, row3_batch, static_bg, anim_bg, &bg_rect, tile_alpha);
 
                     SDL_FRect icon_rect = {
                         bg_rect.x + settings->adv_icon_offset_x, bg_rect.y + settings->adv_icon_offset_y,
@@ -4660,7 +5228,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                                      &o->texture_cache_capacity, icon_path.c_str(),
                                                      SDL_SCALEMODE_NEAREST);
                     }
-                    render_texture_with_alpha(o->renderer, tex, anim_tex, &icon_rect, tile_alpha);
+                    draw_batch_texture(o->renderer, row3_batch, tex, anim_tex, &icon_rect, tile_alpha);
 
 
                     // Text rendering uses cell_width_row3 for centering
@@ -4672,7 +5240,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                         float text_x = current_x + snap_px((cell_width_row3 - w) / 2.0f);
                         // Center using cell_width_row3
                         SDL_FRect dest_rect = {text_x, ROW3_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET, w, h};
-                        render_text_with_alpha(o->renderer, name_texture, &dest_rect, tile_alpha);
+                        draw_batch_text(o->renderer, row3_batch, name_texture, &dest_rect, tile_alpha);
 
                         if (progress_buf[0] != '\0') {
                             // Use progress_buf which holds current text
@@ -4684,7 +5252,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                                 float p_text_x = current_x + snap_px((cell_width_row3 - pw) / 2.0f);
                                 // Center using cell_width_row3
                                 SDL_FRect p_dest_rect = {p_text_x, ROW3_Y_POS + ITEM_WIDTH + TEXT_Y_OFFSET + h, pw, ph};
-                                render_text_with_alpha(o->renderer, progress_texture, &p_dest_rect, tile_alpha);
+                                draw_batch_text(o->renderer, row3_batch, progress_texture, &p_dest_rect, tile_alpha);
                             }
                         }
                     }
@@ -4693,6 +5261,7 @@ void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings) {
                 } // End tile scope
             } // End belt loop
         } // End if F > 0
+        draw_batch_end(o->renderer, row3_batch);
     }
 
     // --- DEBUG: Performance Display ---
@@ -4765,9 +5334,22 @@ void overlay_free(Overlay **overlay, const AppSettings *settings) {
                 if (o->text_cache[i].texture) {
                     SDL_DestroyTexture(o->text_cache[i].texture);
                 }
+                free(o->text_cache[i].long_text);
             }
             free(o->text_cache);
             o->text_cache = nullptr;
+            free(o->text_cache_table);
+            o->text_cache_table = nullptr;
+        }
+
+        icon_atlas_free();
+
+        for (int i = 0; i < OVERLAY_GLYPH_ATLAS_COUNT; i++) {
+            if (o->glyph_atlases[i].texture) {
+                SDL_DestroyTexture(o->glyph_atlases[i].texture);
+                o->glyph_atlases[i].texture = nullptr;
+            }
+            o->glyph_atlases[i].font = nullptr;
         }
 
         if (o->text_engine) {
@@ -30,12 +30,34 @@ struct OverlayDisplayItem {
 // A cache entry for rendered text to avoid re-creating textures every frame
 typedef struct {
     char text[256]; // The text string that was rendered
+    char *long_text; // Heap copy of the whole text when it doesn't fit in text (nullptr otherwise)
     SDL_Color color; // The color it was rendered with
     TTF_Font *font; // The font it was rendered with (top bar and rows can differ)
     SDL_Texture *texture;
-    Uint32 last_used; // SDL tick of the last cache hit, for LRU eviction
+    Uint32 hash; // Key in Overlay::text_cache_table (font, color and text)
+    int lru_prev; // Recency list neighbours (indices into Overlay::text_cache, -1 = none)
+    int lru_next;
 } TextCacheEntry;
 
+// Printable ASCII of one font rendered once into a texture, so volatile text (IGT, timers, live counters)
+// is drawn as glyph quads instead of being rendered into a fresh texture every time it changes.
+#define GLYPH_ATLAS_FIRST_CHAR 32 // ' '
+#define GLYPH_ATLAS_CHAR_COUNT 95 // ' ' .. '~'
+#define OVERLAY_GLYPH_ATLAS_COUNT 5 // One per overlay font
+
+typedef struct {
+    SDL_FRect src; // Glyph cell in the atlas texture (full line height)
+    float offset_x; // Cell position relative to the pen (negative for glyphs reaching left of it)
+    float advance; // Pen movement after the glyph
+} GlyphAtlasGlyph;
+
+typedef struct {
+    TTF_Font *font; // Font the atlas was built from (nullptr = unused slot)
+    SDL_Texture *texture; // White glyphs, tinted per vertex (nullptr if building failed)
+    float line_height;
+    GlyphAtlasGlyph glyphs[GLYPH_ATLAS_CHAR_COUNT];
+} GlyphAtlas;
+
 struct Overlay {
     SDL_Window *window;
     SDL_Renderer *renderer;
@@ -49,6 +71,8 @@ struct Overlay {
     sem_t *mutex;
 #endif
     SharedData *p_shared_data; // Pointer to the mapped shared memory
+    IPCTemplateSegment template_segment; // The tracker's current template segment, mapped on the first pin
+    IPCWakeup wakeup; // Signaled by the tracker on every publish
 
     TTF_TextEngine *text_engine;
     TTF_Font *font; // Rows 2 & 3 text (sdl ttf), sized by overlay_row_font_size
@@ -76,9 +100,13 @@ struct Overlay {
     AnimatedTextureCacheEntry *anim_cache;
     int anim_cache_count;
     int anim_cache_capacity;
-    TextCacheEntry *text_cache;
+    TextCacheEntry *text_cache; // Allocated once at its cap, so indices into it stay valid
     int text_cache_count;
     int text_cache_capacity;
+    int *text_cache_table; // Open-addressing index of text_cache by hash (-1 = empty slot)
+    int text_cache_lru_head; // Most recently used entry
+    int text_cache_lru_tail; // Least recently used entry, evicted first once the cache is full
+    GlyphAtlas glyph_atlases[OVERLAY_GLYPH_ATLAS_COUNT]; // Built on first use per font
 
 
     float social_media_timer; // Timer for cycling promotional text
@@ -183,6 +211,15 @@ void overlay_update(Overlay *o, float *deltaTime, const Tracker *t, const AppSet
  */
 void overlay_render(Overlay *o, const Tracker *t, const AppSettings *settings);
 
+/**
+ * @brief When the overlay needs its next frame, as collected by the last overlay_update and overlay_render.
+ *
+ * @return 0 while something animates continuously (scrolling belt, crop/fade, slides), the SDL tick of
+ * the next timed change (page flip, stat cycle, GIF frame, ...) otherwise, or UINT64_MAX when nothing
+ * on screen changes by itself and only new tracker data or a window event needs a redraw.
+ */
+Uint64 overlay_next_frame_tick();
+
 /**
  * @brief Frees all resources associated with the Overlay instance.
  *
@@ -83,6 +83,8 @@ static void copy_preset_progress_to_settings(const char *preset_path) {
     cJSON *preset_root = cJSON_from_file(preset_path);
     if (!preset_root) return;
 
+    // Fold first, or journaled changes would land on top of the preset's progress
+    settings_progress_journal_fold();
     cJSON *settings_root = cJSON_from_file(get_settings_file_path());
     if (!settings_root) {
         cJSON_Delete(preset_root);
@@ -1481,6 +1483,7 @@ void settings_render_gui(bool *p_open, AppSettings *app_settings, ImFont *roboto
             }
             if (ok) {
                 // Copy the entire current settings.json verbatim into the new preset file.
+                settings_progress_journal_fold();
                 cJSON *root = cJSON_from_file(get_settings_file_path());
                 if (!root) {
                     snprintf(preset_status_msg, sizeof(preset_status_msg),
@@ -7,7 +7,10 @@
 // Created by Linus on 27.06.2025.
 //
 
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 #include "settings_utils.h"
@@ -18,6 +21,7 @@
 #include "main.h"
 #include "format_utils.h"
 #include "coop_net.h" // g_coop_ctx for ghost-player prune exemption
+#include "profiler.h"
 
 // Define the actual constant values for the colors here in the .cpp file.
 const ColorRGBA DEFAULT_TRACKER_BG_COLOR = {13, 17, 23, 255};
@@ -211,9 +215,334 @@ cJSON *settings_get_player_progress_subobj(cJSON *parent_obj, const char *uuid,
     return sub;
 }
 
+// RESIDENT PROGRESS STORE
+
+static const char *const PROGRESS_STORE_SECTIONS[] = {"custom_progress", "stat_progress_override"};
+static JsonFileCache *s_progress_store = nullptr; // Holds the one settings.json entry
+
+static void journal_replay_into_store(cJSON *progress);
+
+static JsonFilterAction progress_store_filter(void *ctx, int depth, const char *parent_key, const char *key) {
+    (void) ctx;
+    (void) depth;
+    (void) parent_key;
+    for (const char *section: PROGRESS_STORE_SECTIONS) {
+        if (strcmp(key, section) == 0) return JSON_FILTER_KEEP;
+    }
+    return JSON_FILTER_SKIP;
+}
+
+cJSON *settings_progress_store_get(void) {
+    if (!s_progress_store) s_progress_store = json_file_cache_new();
+    cJSON *progress = json_file_cache_get(s_progress_store, get_settings_file_path(), progress_store_filter, nullptr);
+    if (progress) journal_replay_into_store(progress);
+    return progress;
+}
+
+void settings_progress_store_commit(const cJSON *written_root) {
+    if (!written_root) return;
+    if (!s_progress_store) s_progress_store = json_file_cache_new();
+    cJSON *progress = cJSON_CreateObject();
+    if (!progress) return;
+    for (const char *section: PROGRESS_STORE_SECTIONS) {
+        cJSON *item = cJSON_GetObjectItemCaseSensitive(written_root, section);
+        if (item) cJSON_AddItemToObject(progress, section, cJSON_Duplicate(item, 1));
+    }
+    json_file_cache_put(s_progress_store, get_settings_file_path(), progress_store_filter, nullptr, progress);
+}
+
+// PROGRESS JOURNAL
+
+// A single progress change (a checkbox click, a hotkey counter step) is appended to "<settings.json>.journal"
+// as one fixed-size record instead of rewriting settings.json. Appends are fsynced in batches, and the journal
+// is folded back into settings.json once enough records pile up, once it goes idle, at shutdown and by any
+// settings_save(). Records hold absolute values, so replaying one that was already folded is harmless.
+#define PROGRESS_JOURNAL_MAGIC 0x4C4A5641u // "AVJL"
+#define PROGRESS_JOURNAL_SYNC_MS 250 // Longest an appended record stays unsynced
+#define PROGRESS_JOURNAL_FOLD_RECORDS 64 // Fold once this many records are pending...
+#define PROGRESS_JOURNAL_FOLD_IDLE_MS 5000 // ...or once nothing was appended for this long
+#define PROGRESS_JOURNAL_MARKER "journal_sequence" // Last record replayed into the resident progress store
+
+enum ProgressJournalKind {
+    JOURNAL_CUSTOM_FLAG = 1, // custom_progress bool (goal 0)
+    JOURNAL_CUSTOM_COUNT, // custom_progress number (goal > 0)
+    JOURNAL_CUSTOM_COUNTER, // custom_progress {completed, progress} (goal -1)
+    JOURNAL_STAT_OVERRIDE, // stat_progress_override bool, removed when false
+};
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence; // Consecutive within one journal file
+    uint8_t kind; // ProgressJournalKind
+    uint8_t completed;
+    uint16_t reserved;
+    int32_t progress;
+    char uuid[48];
+    char key[444]; // Goal root name, or "<stat>.criteria.<sub-stat>" for a sub-stat override
+    uint32_t checksum; // FNV-1a of every byte before it
+} ProgressJournalRecord;
+
+static_assert(sizeof(ProgressJournalRecord) == 512, "Progress journal records have a fixed on-disk size");
+
+static struct {
+    FILE *file; // Open for appending once the journal was recovered (tracker process only)
+    ProgressJournalRecord *pending; // Appended since the last fold, in order
+    int pending_count;
+    int pending_capacity;
+    uint32_t next_sequence; // Never reset, so the store marker stays comparable across folds
+    bool unsynced; // Records were appended after the last fsync
+    Uint64 last_sync_ms;
+    Uint64 last_append_ms;
+    Uint64 fold_retry_ms; // No fold attempt from the tick before this
+    bool recovered; // The file left by a previous run was read back
+} s_journal;
+
+static const char *journal_path(void) {
+    static char path[1088];
+    snprintf(path, sizeof(path), "%s.journal", get_settings_file_path());
+    return path;
+}
+
+static uint32_t journal_checksum(const ProgressJournalRecord *rec) {
+    const unsigned char *bytes = (const unsigned char *) rec;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ProgressJournalRecord, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static bool journal_record_valid(const ProgressJournalRecord *rec) {
+    return rec->magic == PROGRESS_JOURNAL_MAGIC && rec->kind >= JOURNAL_CUSTOM_FLAG &&
+           rec->kind <= JOURNAL_STAT_OVERRIDE && memchr(rec->uuid, '\0', sizeof(rec->uuid)) &&
+           memchr(rec->key, '\0', sizeof(rec->key)) && rec->checksum == journal_checksum(rec);
+}
+
+static bool journal_push(const ProgressJournalRecord *rec) {
+    if (s_journal.pending_count == s_journal.pending_capacity) {
+        int capacity = s_journal.pending_capacity > 0 ? s_journal.pending_capacity * 2 : PROGRESS_JOURNAL_FOLD_RECORDS;
+        auto *grown = (ProgressJournalRecord *) realloc(s_journal.pending, capacity * sizeof(ProgressJournalRecord));
+        if (!grown) return false;
+        s_journal.pending = grown;
+        s_journal.pending_capacity = capacity;
+    }
+    s_journal.pending[s_journal.pending_count++] = *rec;
+    return true;
+}
+
+// Writes one record into a root holding the progress sections (settings.json or the resident store),
+// the same way settings_save() lays them out.
+static void journal_apply_record(cJSON *root, const ProgressJournalRecord *rec) {
+    const char *section = rec->kind == JOURNAL_STAT_OVERRIDE ? "stat_progress_override" : "custom_progress";
+    cJSON *uuid_obj = settings_get_player_progress_subobj(get_or_create_object(root, section), rec->uuid, rec->uuid);
+    if (!uuid_obj) return;
+
+    cJSON_DeleteItemFromObject(uuid_obj, rec->key);
+    switch (rec->kind) {
+        case JOURNAL_CUSTOM_FLAG:
+            cJSON_AddItemToObject(uuid_obj, rec->key, cJSON_CreateBool(rec->completed));
+            break;
+        case JOURNAL_CUSTOM_COUNT:
+            cJSON_AddItemToObject(uuid_obj, rec->key, cJSON_CreateNumber(rec->progress));
+            break;
+        case JOURNAL_CUSTOM_COUNTER: {
+            cJSON *obj = cJSON_CreateObject();
+            cJSON_AddBoolToObject(obj, "completed", rec->completed);
+            cJSON_AddNumberToObject(obj, "progress", rec->progress);
+            cJSON_AddItemToObject(uuid_obj, rec->key, obj);
+            break;
+        }
+        case JOURNAL_STAT_OVERRIDE:
+            if (rec->completed) cJSON_AddItemToObject(uuid_obj, rec->key, cJSON_CreateTrue());
+            break;
+        default:
+            break;
+    }
+}
+
+static void journal_apply_pending(cJSON *root) {
+    for (int i = 0; i < s_journal.pending_count; i++) journal_apply_record(root, &s_journal.pending[i]);
+}
+
+// Replays the records the resident store hasn't seen yet. A store freshly parsed from disk or committed
+// carries no marker and gets every pending record.
+static void journal_replay_into_store(cJSON *progress) {
+    if (s_journal.pending_count == 0) return;
+    cJSON *marker = cJSON_GetObjectItemCaseSensitive(progress, PROGRESS_JOURNAL_MARKER);
+    bool has_marker = cJSON_IsNumber(marker);
+    uint32_t applied = has_marker ? (uint32_t) marker->valuedouble : 0;
+    for (int i = 0; i < s_journal.pending_count; i++) {
+        if (has_marker && s_journal.pending[i].sequence <= applied) continue;
+        journal_apply_record(progress, &s_journal.pending[i]);
+    }
+    double last = s_journal.pending[s_journal.pending_count - 1].sequence;
+    if (has_marker) cJSON_SetNumberValue(marker, last);
+    else cJSON_AddNumberToObject(progress, PROGRESS_JOURNAL_MARKER, last);
+}
+
+// Opens the journal for appending, first reading back whatever a previous run appended but never folded.
+// Only the valid prefix survives: a torn or corrupt record ends the replay and the file is rewritten.
+static bool journal_open(void) {
+    if (s_journal.file) return true;
+
+    const char *path = journal_path();
+    bool torn = false;
+    FILE *in = s_journal.recovered ? nullptr : fopen(path, "rb");
+    s_journal.recovered = true;
+    if (in) {
+        ProgressJournalRecord rec;
+        size_t n;
+        while ((n = fread(&rec, 1, sizeof(rec), in)) == sizeof(rec)) {
+            bool in_order = s_journal.pending_count == 0 ||
+                            rec.sequence == s_journal.pending[s_journal.pending_count - 1].sequence + 1;
+            if (!journal_record_valid(&rec) || !in_order || !journal_push(&rec)) break;
+        }
+        torn = n != 0 || !feof(in);
+        fclose(in);
+    }
+    if (s_journal.pending_count > 0) {
+        s_journal.next_sequence = s_journal.pending[s_journal.pending_count - 1].sequence + 1;
+        log_message(LOG_INFO, "[SETTINGS UTILS] Recovered %d progress journal record(s).\n", s_journal.pending_count);
+    }
+
+    s_journal.file = fopen(path, torn ? "wb" : "ab");
+    if (!s_journal.file) {
+        log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to open progress journal: %s\n", path);
+        return false;
+    }
+    if (torn) {
+        log_message(LOG_ERROR, "[SETTINGS UTILS] Dropped a torn tail from the progress journal: %s\n", path);
+        size_t count = (size_t) s_journal.pending_count;
+        if (fwrite(s_journal.pending, sizeof(ProgressJournalRecord), count, s_journal.file) != count ||
+            !fs_sync_file(s_journal.file)) {
+            log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to rewrite progress journal: %s\n", path);
+        }
+    }
+    return true;
+}
+
+// Drops every pending record once settings.json holds them.
+static void journal_reset(void) {
+    s_journal.pending_count = 0;
+    s_journal.unsynced = false;
+    if (!s_journal.file) return;
+    fclose(s_journal.file);
+    s_journal.file = fopen(journal_path(), "wb");
+    if (!s_journal.file) {
+        // Never leave folded records behind to be replayed over newer writes
+        remove(journal_path());
+        log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to truncate progress journal: %s\n", journal_path());
+    }
+}
+
+static bool journal_append(ProgressJournalKind kind, const char *uuid, const char *key, bool completed,
+                           int progress) {
+    ProgressJournalRecord rec;
+    if (!uuid || uuid[0] == '\0' || !key || strlen(uuid) >= sizeof(rec.uuid) || strlen(key) >= sizeof(rec.key)) {
+        return false;
+    }
+    if (!journal_open()) return false;
+
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = PROGRESS_JOURNAL_MAGIC;
+    rec.sequence = s_journal.next_sequence;
+    rec.kind = (uint8_t) kind;
+    rec.completed = completed ? 1 : 0;
+    rec.progress = progress;
+    snprintf(rec.uuid, sizeof(rec.uuid), "%s", uuid);
+    snprintf(rec.key, sizeof(rec.key), "%s", key);
+    rec.checksum = journal_checksum(&rec);
+
+    if (!journal_push(&rec)) return false;
+    if (fwrite(&rec, sizeof(rec), 1, s_journal.file) != 1 || fflush(s_journal.file) != 0) {
+        // The caller falls back to settings_save(), whose fold also truncates whatever part of this record landed
+        s_journal.pending_count--;
+        log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to append to progress journal: %s\n", journal_path());
+        return false;
+    }
+    s_journal.next_sequence++;
+    s_journal.unsynced = true;
+    s_journal.last_append_ms = SDL_GetTicks();
+    profiler_count("progress journal appends");
+    return true;
+}
+
+bool settings_progress_journal_custom_goal(const char *uuid, const TrackableItem *item) {
+    if (!item) return false;
+    ProgressJournalKind kind = item->goal == -1
+                                   ? JOURNAL_CUSTOM_COUNTER
+                                   : (item->goal > 0 ? JOURNAL_CUSTOM_COUNT : JOURNAL_CUSTOM_FLAG);
+    return journal_append(kind, uuid, item->root_name, item->is_manually_completed, item->progress);
+}
+
+bool settings_progress_journal_stat_override(const char *uuid, const char *key, bool completed) {
+    return journal_append(JOURNAL_STAT_OVERRIDE, uuid, key, completed, 0);
+}
+
+bool settings_progress_journal_fold(void) {
+    if (s_journal.pending_count == 0) return true;
+
+    // An unreadable settings.json is left alone; the journal keeps the records until it can be read again
+    cJSON *root = cJSON_from_file(get_settings_file_path());
+    if (!root) return false;
+
+    journal_apply_pending(root);
+    SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
+    bool ok = cJSON_write_to_file_atomic(get_settings_file_path(), root);
+    if (ok) {
+        settings_progress_store_commit(root);
+        journal_reset();
+        profiler_count("progress journal folds");
+    } else {
+        log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to fold progress journal into: %s\n",
+                    get_settings_file_path());
+    }
+    cJSON_Delete(root);
+    return ok;
+}
+
+void settings_progress_journal_recover(void) {
+    if (journal_open()) settings_progress_journal_fold();
+}
+
+void settings_progress_journal_tick(void) {
+    if (!s_journal.file) return;
+    Uint64 now = SDL_GetTicks();
+
+    // A failed fold is retried after an idle period instead of every frame
+    if (now >= s_journal.fold_retry_ms && (s_journal.pending_count >= PROGRESS_JOURNAL_FOLD_RECORDS ||
+                                           (s_journal.pending_count > 0 &&
+                                            now - s_journal.last_append_ms >= PROGRESS_JOURNAL_FOLD_IDLE_MS))) {
+        if (!settings_progress_journal_fold()) s_journal.fold_retry_ms = now + PROGRESS_JOURNAL_FOLD_IDLE_MS;
+    }
+
+    if (s_journal.unsynced && now - s_journal.last_sync_ms >= PROGRESS_JOURNAL_SYNC_MS) {
+        if (!fs_sync_file(s_journal.file)) {
+            log_message(LOG_ERROR, "[SETTINGS UTILS] Failed to sync progress journal: %s\n", journal_path());
+        }
+        s_journal.unsynced = false;
+        s_journal.last_sync_ms = now;
+    }
+}
+
+void settings_progress_journal_shutdown(void) {
+    settings_progress_journal_fold();
+    if (s_journal.file) {
+        fs_sync_file(s_journal.file);
+        fclose(s_journal.file);
+        s_journal.file = nullptr;
+    }
+    free(s_journal.pending);
+    s_journal.pending = nullptr;
+    s_journal.pending_count = 0;
+    s_journal.pending_capacity = 0;
+}
+
 void settings_prune_stale_coop_progress(const AppSettings *settings) {
     if (!settings || settings->coop_player_count <= 0) return;
 
+    // Fold first, so the store committed below holds the journaled changes too
+    settings_progress_journal_fold();
     cJSON *root = cJSON_from_file(get_settings_file_path());
     if (!root) return;
 
@@ -261,7 +590,7 @@ void settings_prune_stale_coop_progress(const AppSettings *settings) {
 
     if (changed) {
         SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-        cJSON_write_to_file_atomic(get_settings_file_path(), root);
+        if (cJSON_write_to_file_atomic(get_settings_file_path(), root)) settings_progress_store_commit(root);
     }
     cJSON_Delete(root);
 }
@@ -3837,6 +4166,9 @@ void settings_save(const AppSettings *settings, const TemplateData *td, Settings
                               cJSON_CreateNumber(settings->tracker_list_scroll_speed));
     }
 
+    // Progress still waiting in the journal goes into this write; td (if given) overrides it below
+    journal_apply_pending(root);
+
     // Update Custom Progress if provided (per-UUID schema)
     if (td) {
         const char *local_uuid = settings->local_player.uuid;
@@ -3953,6 +4285,8 @@ void settings_save(const AppSettings *settings, const TemplateData *td, Settings
     // keeps any concurrent reader (file watcher thread, a second process) from
     // ever seeing a truncated settings.json, which is what corrupts it.
     if (cJSON_write_to_file_atomic(get_settings_file_path(), root)) {
+        settings_progress_store_commit(root);
+        journal_reset();
         // Keep a last-known-good backup so an externally corrupted settings.json
         // (antivirus, cloud sync, disk error) can be recovered without resetting.
         char backup_path[1088];
@@ -1102,6 +1102,59 @@ cJSON *settings_get_player_progress_subobj(cJSON *parent_obj, const char *uuid,
  */
 void settings_prune_stale_coop_progress(const AppSettings *settings);
 
+/**
+ * @brief The progress sections of settings.json (`custom_progress`, `stat_progress_override`), kept resident.
+ * settings.json is only read again when it changed outside of settings_progress_store_commit (an external
+ * edit or a write that didn't commit), and then only those two sections are materialised.
+ * @return The resident progress object, or NULL if settings.json is missing or unreadable. Owned by the
+ * store: never modify or free it, and don't hold it past the next get or commit.
+ */
+cJSON *settings_progress_store_get(void);
+
+/**
+ * @brief Hands the progress sections of a settings root that was just written to settings.json to the
+ * resident store, so the write is not parsed back from disk. Call after every successful write.
+ */
+void settings_progress_store_commit(const cJSON *written_root);
+
+/**
+ * @brief Records a singleplayer custom goal change (toggle or counter step) in the progress journal instead of
+ * rewriting settings.json. The record holds the goal's current state, laid out like settings_save() would.
+ * Tracker process, main thread only.
+ * @return true if the change is journaled; false if it couldn't be, and the caller has to settings_save().
+ */
+bool settings_progress_journal_custom_goal(const char *uuid, const TrackableItem *item);
+
+/**
+ * @brief Records a stat override change in the progress journal, see settings_progress_journal_custom_goal().
+ * @param key The stat's root name, or "<stat>.criteria.<sub-stat>" for a sub-stat of a multi-criterion stat.
+ */
+bool settings_progress_journal_stat_override(const char *uuid, const char *key, bool completed);
+
+/**
+ * @brief Writes every journaled change into settings.json and empties the journal. settings_save() does the
+ * same as part of its own write. No-op when nothing is pending.
+ * @return true if nothing was pending or the fold succeeded.
+ */
+bool settings_progress_journal_fold(void);
+
+/**
+ * @brief Replays the journal a previous run left behind (up to the first torn record) into settings.json.
+ * Call once at tracker startup, before settings.json is written for the first time.
+ */
+void settings_progress_journal_recover(void);
+
+/**
+ * @brief Per-frame upkeep: fsyncs appended records in batches and folds the journal once it holds enough
+ * records or went idle.
+ */
+void settings_progress_journal_tick(void);
+
+/**
+ * @brief Folds and closes the journal. Call once at tracker shutdown.
+ */
+void settings_progress_journal_shutdown(void);
+
 /**
  * @brief Constructs the full paths to the template, language, snapshot JSON and notes TXT files. Does NOT CREATE the files or load them.
  *
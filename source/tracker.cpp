@@ -19,6 +19,7 @@
 #include <cJSON.h>
 #include <cmath>
 #include <ctime>
+#include <climits>
 
 #include "tracker.h"
 
@@ -1175,8 +1176,8 @@ static int tracker_compute_progress_total(const TrackableCategory *adv) {
  * StatsPerWorld is enabled and no baseline is used). Stats are baseline-
  * subtracted; done_in_snapshot is set from the baseline's achievement set.
  */
-static void tracker_update_stats_legacy(Tracker *t, const cJSON *player_stats_json, const char *uuid,
-                                        const PlayerLegacySnapshot *baseline) {
+static void tracker_update_stats_legacy(Tracker *t, const cJSON *player_stats_json, cJSON *settings_json,
+                                        const char *uuid, const PlayerLegacySnapshot *baseline) {
     if (!player_stats_json) return;
 
     cJSON *stats_change = cJSON_GetObjectItem(player_stats_json, "stats-change");
@@ -1208,7 +1209,6 @@ static void tracker_update_stats_legacy(Tracker *t, const cJSON *player_stats_js
         if (ach->done) t->template_data->advancements_completed_count++;
     }
 
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
     cJSON *override_obj = get_per_uuid_progress_obj(settings_json, "stat_progress_override", uuid);
 
     t->template_data->play_time_ticks = 0;
@@ -1302,14 +1302,13 @@ static void tracker_update_stats_legacy(Tracker *t, const cJSON *player_stats_js
             break;
         }
     }
-
-    cJSON_Delete(settings_json);
 }
 
 /**
  * @brief (Era 2: 1.7.2-1.11.2) Parses unified JSON with achievements and stats.
  */
-static void tracker_update_achievements_and_stats_mid(Tracker *t, const cJSON *player_stats_json, const char *uuid) {
+static void tracker_update_achievements_and_stats_mid(Tracker *t, const cJSON *player_stats_json,
+                                                     cJSON *settings_json, const char *uuid) {
     if (!player_stats_json) return;
 
     t->template_data->advancements_completed_count = 0;
@@ -1375,7 +1374,6 @@ static void tracker_update_achievements_and_stats_mid(Tracker *t, const cJSON *p
     }
 
     // Stats logic with sub-stats
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
     cJSON *override_obj = get_per_uuid_progress_obj(settings_json, "stat_progress_override", uuid);
 
     t->template_data->stats_completed_count = 0;
@@ -1434,8 +1432,6 @@ static void tracker_update_achievements_and_stats_mid(Tracker *t, const cJSON *p
         t->template_data->stats_completed_criteria_count += stat_cat->completed_criteria_count;
     }
 
-    cJSON_Delete(settings_json);
-
     // Update mid-era playtime
     cJSON *play_time_entry = cJSON_GetObjectItem(player_stats_json, "stat.playOneMinute");
     if (cJSON_IsNumber(play_time_entry)) {
@@ -1517,6 +1513,288 @@ static void tracker_update_stats_mid(Tracker *t, const cJSON *player_stats_json,
     }
 }
 
+// Appends s lowercased, so hash keys compare like cJSON's case-insensitive object lookup
+static void append_lower_ascii(std::string &key, const char *s) {
+    for (; *s; s++) key += (char) tolower((unsigned char) *s);
+}
+
+// Template advancement and criterion names hashed once per template load. Matching a player advancements
+// file walks that file exactly once and looks every entry up here, instead of scanning the file for each
+// template advancement and each entry's criteria for each template criterion. Keys are lowercased, and
+// repeated names map to every advancement/criterion carrying them, both as with cJSON_GetObjectItem.
+struct AdvancementMatchIndex {
+    std::unordered_multimap<std::string, int> advancements; // root_name -> index in TemplateData::advancements
+    std::vector<std::unordered_multimap<std::string, int> > criteria; // Per advancement: root_name -> criterion
+    std::string probe; // Reused lookup key
+};
+
+static void advancement_match_index_free(AdvancementMatchIndex *index) {
+    delete index;
+}
+
+/**
+ * @brief Hashes the template's advancement and criterion names. Called once per template load.
+ */
+static void tracker_build_advancement_match_index(TemplateData *td) {
+    advancement_match_index_free(td->advancement_match_index);
+    AdvancementMatchIndex *index = new AdvancementMatchIndex();
+    index->criteria.resize(td->advancement_count);
+
+    std::string key;
+    for (int i = 0; i < td->advancement_count; i++) {
+        TrackableCategory *adv = td->advancements[i];
+        key.clear();
+        append_lower_ascii(key, adv->root_name);
+        index->advancements.emplace(key, i);
+        for (int j = 0; j < adv->criteria_count; j++) {
+            key.clear();
+            append_lower_ascii(key, adv->criteria[j]->root_name);
+            index->criteria[i].emplace(key, j);
+        }
+    }
+    td->advancement_match_index = index;
+}
+
+/**
+ * @brief Walks a player advancements file once and pairs each template advancement with its entry.
+ * @param out_entries Resized to advancement_count; nullptr where the player file has no entry.
+ */
+static void advancement_match_entries(TemplateData *td, const cJSON *player_adv_json,
+                                      std::vector<const cJSON *> &out_entries) {
+    if (!td->advancement_match_index) tracker_build_advancement_match_index(td);
+    AdvancementMatchIndex *index = td->advancement_match_index;
+    out_entries.assign(td->advancement_count, nullptr);
+
+    int walked = 0;
+    for (const cJSON *entry = player_adv_json->child; entry; entry = entry->next) {
+        walked++;
+        if (!entry->string) continue;
+        index->probe.clear();
+        append_lower_ascii(index->probe, entry->string);
+        auto range = index->advancements.equal_range(index->probe);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!out_entries[it->second]) out_entries[it->second] = entry; // First occurrence wins
+        }
+    }
+    profiler_count_n("advancement entries matched", walked);
+}
+
+/**
+ * @brief Walks one player "criteria" object once and sets the flag of every template criterion it holds.
+ * @param out_flags One flag per criterion of the advancement, expected to be cleared by the caller.
+ */
+static void advancement_match_criteria(TemplateData *td, int adv_index, const cJSON *player_criteria,
+                                       char *out_flags) {
+    AdvancementMatchIndex *index = td->advancement_match_index;
+    const std::unordered_multimap<std::string, int> &criteria = index->criteria[adv_index];
+    for (const cJSON *entry = player_criteria->child; entry; entry = entry->next) {
+        if (!entry->string) continue;
+        index->probe.clear();
+        append_lower_ascii(index->probe, entry->string);
+        auto range = criteria.equal_range(index->probe);
+        for (auto it = range.first; it != range.second; ++it) out_flags[it->second] = 1;
+    }
+}
+
+// Lowercased keys of the player files the loaded template reads. Modern advancements and stats files are
+// streamed against these (cJSON_from_file_filtered), so only tracked members become cJSON nodes; late-game
+// stats files and the recipe-heavy advancements file are mostly untracked.
+struct PlayerFileKeySet {
+    std::unordered_set<std::string> advancements; // Top-level keys of the advancements file
+    std::unordered_set<std::string> stat_categories; // "minecraft:mined", ...
+    std::unordered_set<std::string> stats; // "category/item"
+    std::string probe; // Reused lookup key
+};
+
+static void player_file_key_set_free(PlayerFileKeySet *keys) {
+    delete keys;
+}
+
+static void player_file_keys_add_stat(PlayerFileKeySet *keys, const char *category, const char *item) {
+    std::string key;
+    append_lower_ascii(key, category);
+    keys->stat_categories.insert(key);
+    key += '/';
+    append_lower_ascii(key, item);
+    keys->stats.insert(key);
+}
+
+/**
+ * @brief Collects every advancements/stats file key the template reads: advancements, stats,
+ * multi-stage stages and the playtime stats. Called once per template load.
+ */
+static void tracker_build_player_file_keys(TemplateData *td) {
+    player_file_key_set_free(td->player_file_keys);
+    PlayerFileKeySet *keys = new PlayerFileKeySet();
+    std::string key;
+
+    for (int i = 0; i < td->advancement_count; i++) {
+        key.clear();
+        append_lower_ascii(key, td->advancements[i]->root_name);
+        keys->advancements.insert(key);
+    }
+    for (int i = 0; i < td->stat_count; i++) {
+        TrackableCategory *stat_cat = td->stats[i];
+        for (int j = 0; j < stat_cat->criteria_count; j++) {
+            TrackableItem *sub_stat = stat_cat->criteria[j];
+            if (sub_stat->stat_category_key[0] == '\0') continue;
+            player_file_keys_add_stat(keys, sub_stat->stat_category_key, sub_stat->stat_item_key);
+        }
+    }
+    for (int i = 0; i < td->multi_stage_goal_count; i++) {
+        MultiStageGoal *goal = td->multi_stage_goals[i];
+        for (int j = 0; goal && j < goal->stage_count; j++) {
+            SubGoal *stage = goal->stages[j];
+            if (!stage) continue;
+            key.clear();
+            if (stage->type == SUBGOAL_ADVANCEMENT) {
+                append_lower_ascii(key, stage->root_name);
+                keys->advancements.insert(key);
+            } else if (stage->type == SUBGOAL_CRITERION) {
+                append_lower_ascii(key, stage->parent_advancement);
+                keys->advancements.insert(key);
+            } else if (stage->type == SUBGOAL_STAT) {
+                const char *slash = strchr(stage->root_name, '/');
+                if (!slash) continue;
+                std::string category(stage->root_name, slash - stage->root_name);
+                player_file_keys_add_stat(keys, category.c_str(), slash + 1);
+            }
+        }
+    }
+    player_file_keys_add_stat(keys, "minecraft:custom", "minecraft:play_time");
+    player_file_keys_add_stat(keys, "minecraft:custom", "minecraft:play_one_minute");
+    td->player_file_keys = keys;
+}
+
+// Everything in the template one Hermes stat key feeds. Slots keep template order: sub-stats of one category
+// and stages of one multi-stage goal are adjacent.
+struct HermesStatSlots {
+    struct SubStat {
+        TrackableCategory *category;
+        TrackableItem *sub_stat;
+    };
+
+    struct Stage {
+        MultiStageGoal *goal;
+        int stage_index; // Only fed while it is the goal's current stage
+    };
+
+    std::vector<SubStat> sub_stats;
+    std::vector<Stage> stages;
+};
+
+// Hermes stat keys resolved once per template load, so a stat event goes straight to the goals it feeds instead
+// of comparing its key against every sub-stat and stage. Modern keys ("minecraft.picked_up:minecraft.oak_log")
+// are looked up in their "category\nitem" template form (see hermes_parse_stat_key), mid-era "stat.*" and legacy
+// numeric keys verbatim by root_name. Case-sensitive, like the strcmp matching it replaces.
+struct HermesStatIndex {
+    std::unordered_map<std::string, HermesStatSlots> modern;
+    std::unordered_map<std::string, HermesStatSlots> legacy;
+    std::string probe; // Reused lookup key
+};
+
+static void hermes_stat_index_free(HermesStatIndex *index) {
+    delete index;
+}
+
+static void hermes_stat_modern_key(std::string &key, const char *category, size_t category_len, const char *item) {
+    key.assign(category, category_len);
+    key += '\n';
+    key += item;
+}
+
+/**
+ * @brief Maps every Hermes stat key form to the sub-stats and SUBGOAL_STAT stages it feeds. Called once per
+ * template load.
+ */
+static void tracker_build_hermes_stat_index(TemplateData *td) {
+    hermes_stat_index_free(td->hermes_stat_index);
+    HermesStatIndex *index = new HermesStatIndex();
+    std::string key;
+
+    for (int i = 0; i < td->stat_count; i++) {
+        TrackableCategory *stat_cat = td->stats[i];
+        if (!stat_cat) continue;
+        for (int j = 0; j < stat_cat->criteria_count; j++) {
+            TrackableItem *sub_stat = stat_cat->criteria[j];
+            if (!sub_stat) continue;
+            HermesStatSlots::SubStat slot = {stat_cat, sub_stat};
+            if (sub_stat->stat_category_key[0] != '\0') {
+                hermes_stat_modern_key(key, sub_stat->stat_category_key, strlen(sub_stat->stat_category_key),
+                                       sub_stat->stat_item_key);
+                index->modern[key].sub_stats.push_back(slot);
+            }
+            index->legacy[sub_stat->root_name].sub_stats.push_back(slot);
+        }
+    }
+
+    for (int i = 0; i < td->multi_stage_goal_count; i++) {
+        MultiStageGoal *goal = td->multi_stage_goals[i];
+        for (int j = 0; goal && j < goal->stage_count; j++) {
+            SubGoal *stage = goal->stages[j];
+            if (!stage || stage->type != SUBGOAL_STAT) continue;
+            HermesStatSlots::Stage slot = {goal, j};
+            // Modern template format: "minecraft:picked_up/minecraft:wither_skeleton_skull"
+            const char *slash = strchr(stage->root_name, '/');
+            if (slash && slash != stage->root_name) {
+                hermes_stat_modern_key(key, stage->root_name, (size_t) (slash - stage->root_name), slash + 1);
+                index->modern[key].stages.push_back(slot);
+            }
+            // Legacy/mid-era: "5242881" or "stat.pickup.minecraft.skull"
+            index->legacy[stage->root_name].stages.push_back(slot);
+        }
+    }
+    td->hermes_stat_index = index;
+}
+
+static JsonFilterAction player_adv_file_filter(void *ctx, int depth, const char *parent_key, const char *key) {
+    (void) depth;
+    (void) parent_key;
+    PlayerFileKeySet *keys = (PlayerFileKeySet *) ctx;
+    keys->probe.clear();
+    append_lower_ascii(keys->probe, key);
+    return keys->advancements.count(keys->probe) ? JSON_FILTER_KEEP : JSON_FILTER_SKIP;
+}
+
+static JsonFilterAction player_stats_file_filter(void *ctx, int depth, const char *parent_key, const char *key) {
+    PlayerFileKeySet *keys = (PlayerFileKeySet *) ctx;
+    keys->probe.clear();
+    if (depth == 0) return strcasecmp(key, "stats") == 0 ? JSON_FILTER_DESCEND : JSON_FILTER_SKIP;
+    if (depth == 1) {
+        append_lower_ascii(keys->probe, key);
+        return keys->stat_categories.count(keys->probe) ? JSON_FILTER_DESCEND : JSON_FILTER_SKIP;
+    }
+    append_lower_ascii(keys->probe, parent_key);
+    keys->probe += '/';
+    append_lower_ascii(keys->probe, key);
+    return keys->stats.count(keys->probe) ? JSON_FILTER_KEEP : JSON_FILTER_SKIP;
+}
+
+/**
+ * @brief Reads a modern (1.12+) player advancements file, keeping only the entries the template reads.
+ * The result is owned by the tracker's file cache and reused until the file changes.
+ */
+static cJSON *tracker_player_adv_json(Tracker *t, const char *path) {
+    PlayerFileKeySet *keys = t->template_data->player_file_keys;
+    return json_file_cache_get(t->json_file_cache, path, keys ? player_adv_file_filter : nullptr, keys);
+}
+
+/**
+ * @brief Reads a player stats file. For 1.13+ only the stats the template reads are kept; the flat
+ * mid-era and legacy formats are parsed in full. Owned by the tracker's file cache.
+ */
+static cJSON *tracker_player_stats_json(Tracker *t, const char *path, MC_Version version) {
+    PlayerFileKeySet *keys = (version >= MC_VERSION_1_13) ? t->template_data->player_file_keys : nullptr;
+    return json_file_cache_get(t->json_file_cache, path, keys ? player_stats_file_filter : nullptr, keys);
+}
+
+/**
+ * @brief Reads a JSON file in full (unlocks, settings.json) through the tracker's file cache.
+ */
+static cJSON *tracker_cached_json(Tracker *t, const char *path) {
+    return json_file_cache_get(t->json_file_cache, path, nullptr, nullptr);
+}
+
 /**
  * @brief (Era 3: 1.12+) Updates advancement progress from modern JSON files.
  * It marks an advancement as completed if all of its criteria within the template are completed.
@@ -1529,22 +1807,28 @@ static void tracker_update_advancements_modern(Tracker *t, const cJSON *player_a
     t->template_data->advancements_completed_count = 0;
     t->template_data->completed_criteria_count = 0;
 
+    // Pair template advancements with their player entries in one pass over the file
+    std::vector<const cJSON *> player_entries;
+    advancement_match_entries(t->template_data, player_adv_json, player_entries);
+    std::vector<char> crit_flags;
+
     for (int i = 0; i < t->template_data->advancement_count; i++) {
         TrackableCategory *adv = t->template_data->advancements[i];
         adv->completed_criteria_count = 0;
         adv->done = false; // Reset done status before re-evaluating
         adv->all_template_criteria_met = false;
 
-        cJSON *player_entry = cJSON_GetObjectItem(player_adv_json, adv->root_name);
+        const cJSON *player_entry = player_entries[i];
         // take root name (from template) from player advancements
         if (player_entry) {
             // Always update criteria progress first
             cJSON *player_criteria = cJSON_GetObjectItem(player_entry, "criteria");
             if (player_criteria && adv->criteria_count > 0) {
                 // If the template has criteria, check them against player data
+                crit_flags.assign(adv->criteria_count, 0);
+                advancement_match_criteria(t->template_data, i, player_criteria, crit_flags.data());
                 for (int j = 0; j < adv->criteria_count; j++) {
-                    TrackableItem *crit = adv->criteria[j];
-                    crit->done = cJSON_HasObjectItem(player_criteria, crit->root_name);
+                    adv->criteria[j]->done = crit_flags[j];
                 }
                 adv->completed_criteria_count = tracker_collapse_advancement_groups(adv);
             }
@@ -1576,11 +1860,75 @@ static void tracker_update_advancements_modern(Tracker *t, const cJSON *player_a
     }
 }
 
+// Numeric values of one modern (1.13+) stats file keyed "category/item" (the SubGoal root_name form), lowercased.
+// cJSON object lookup is a linear, case-insensitive list walk and "minecraft:mined", "minecraft:used" and
+// "minecraft:picked_up" hold hundreds of keys late in a run, so each file is indexed once per read
+// instead of being walked again for every template stat.
+struct ModernStatsIndex {
+    std::unordered_map<std::string, int> values;
+    std::string probe; // Reused lookup key, avoids an allocation per lookup
+};
+
+/**
+ * @brief Indexes every numeric stat of a modern stats file in one pass over its "stats" object.
+ * Duplicate keys keep their first occurrence, matching cJSON_GetObjectItem.
+ */
+static void modern_stats_index_build(ModernStatsIndex *index, const cJSON *player_stats_json) {
+    index->values.clear();
+    cJSON *stats_obj = player_stats_json ? cJSON_GetObjectItem(player_stats_json, "stats") : nullptr;
+    if (!stats_obj) return;
+
+    std::string key;
+    for (cJSON *category = stats_obj->child; category; category = category->next) {
+        if (!category->string || !cJSON_IsObject(category)) continue;
+        for (cJSON *item = category->child; item; item = item->next) {
+            if (!item->string || !cJSON_IsNumber(item)) continue;
+            key.clear();
+            append_lower_ascii(key, category->string);
+            key += '/';
+            append_lower_ascii(key, item->string);
+            index->values.emplace(key, item->valueint);
+        }
+    }
+    profiler_count_n("stats entries indexed", (int) index->values.size());
+}
+
+/**
+ * @brief Looks up a modern stat by its "category/item" path, e.g. "minecraft:mined/minecraft:stone".
+ * @return true if the stats file holds a numeric value for it.
+ */
+static bool modern_stats_index_find(ModernStatsIndex *index, const char *path, int *out_value) {
+    if (!index || !path || path[0] == '\0') return false;
+    index->probe.clear();
+    append_lower_ascii(index->probe, path);
+    auto it = index->values.find(index->probe);
+    if (it == index->values.end()) return false;
+    *out_value = it->second;
+    return true;
+}
+
+/**
+ * @brief Looks up a modern stat by its pre-parsed category and item keys.
+ */
+static bool modern_stats_index_find(ModernStatsIndex *index, const char *category, const char *item,
+                                    int *out_value) {
+    if (!index || !category || category[0] == '\0' || !item) return false;
+    index->probe.clear();
+    append_lower_ascii(index->probe, category);
+    index->probe += '/';
+    append_lower_ascii(index->probe, item);
+    auto it = index->values.find(index->probe);
+    if (it == index->values.end()) return false;
+    *out_value = it->second;
+    return true;
+}
+
 /**
  * @brief (Era 3: 1.12+) Updates stat progress from modern JSON files.
  */
 static void tracker_update_stats_modern(Tracker *t, const cJSON *player_stats_json, cJSON *settings_json,
-                                        MC_Version version, const char *uuid) {
+                                        MC_Version version, const char *uuid,
+                                        ModernStatsIndex *stats_index) {
     if (!player_stats_json) return;
 
     cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
@@ -1617,19 +1965,11 @@ static void tracker_update_stats_modern(Tracker *t, const cJSON *player_stats_js
             TrackableItem *sub_stat = stat_cat->criteria[j];
             sub_stat->progress = 0;
 
-            char root_name_copy[192];
-            strncpy(root_name_copy, sub_stat->root_name, sizeof(root_name_copy) - 1);
-            root_name_copy[sizeof(root_name_copy) - 1] = '\0';
-
             // Use pre-parsed keys for lookup
-            if (sub_stat->stat_category_key[0] != '\0') {
-                cJSON *category_obj = cJSON_GetObjectItem(stats_obj, sub_stat->stat_category_key);
-                if (category_obj) {
-                    cJSON *stat_value = cJSON_GetObjectItem(category_obj, sub_stat->stat_item_key);
-                    if (cJSON_IsNumber(stat_value)) {
-                        sub_stat->progress = stat_value->valueint;
-                    }
-                }
+            int stat_value;
+            if (modern_stats_index_find(stats_index, sub_stat->stat_category_key, sub_stat->stat_item_key,
+                                        &stat_value)) {
+                sub_stat->progress = stat_value;
             }
 
             // Determine natural completion
@@ -1666,11 +2006,110 @@ static void tracker_update_stats_modern(Tracker *t, const cJSON *player_stats_js
     }
 }
 
+// TEMPLATE ARENA
+
+// Every goal, criterion, stage, pointer array and linked-goal array of one loaded template is bump-allocated
+// from this arena, so it lies contiguously in parse order and dropping the template is a single reset instead
+// of a walk freeing each object. The arena outlives reloads: a reset keeps one block sized for everything the
+// last template used, so the next load of a similar template fits without touching the heap.
+#define TEMPLATE_ARENA_BLOCK_SIZE (256 * 1024) // Smallest block
+#define TEMPLATE_ARENA_ALIGN 16
+
+struct TemplateArenaBlock {
+    TemplateArenaBlock *next; // Older block
+    size_t capacity; // Usable bytes after the header
+    size_t used;
+};
+
+struct TemplateArena {
+    TemplateArenaBlock *blocks; // Newest first, allocations come from the head
+};
+
+static size_t template_arena_align(size_t v) {
+    return (v + TEMPLATE_ARENA_ALIGN - 1) & ~(size_t) (TEMPLATE_ARENA_ALIGN - 1);
+}
+
+static unsigned char *template_arena_block_data(TemplateArenaBlock *block) {
+    return (unsigned char *) block + template_arena_align(sizeof(TemplateArenaBlock));
+}
+
+static TemplateArenaBlock *template_arena_block_new(size_t capacity, TemplateArenaBlock *next) {
+    auto *block = (TemplateArenaBlock *) malloc(template_arena_align(sizeof(TemplateArenaBlock)) + capacity);
+    if (!block) return nullptr;
+    block->next = next;
+    block->capacity = capacity;
+    block->used = 0;
+    return block;
+}
+
+static TemplateArena *template_arena_new() {
+    return (TemplateArena *) calloc(1, sizeof(TemplateArena));
+}
+
+/**
+ * @brief calloc() replacement for template data: zeroed, aligned, and only released by a reset.
+ * @return nullptr if the size overflows or the heap is exhausted.
+ */
+static void *template_arena_calloc(TemplateArena *arena, size_t count, size_t size) {
+    if (!arena || (size != 0 && count > SIZE_MAX / size)) return nullptr;
+    size_t bytes = count * size;
+    if (bytes > SIZE_MAX - TEMPLATE_ARENA_BLOCK_SIZE) return nullptr;
+    bytes = template_arena_align(bytes > 0 ? bytes : 1);
+
+    TemplateArenaBlock *block = arena->blocks;
+    if (!block || block->capacity - block->used < bytes) {
+        // Blocks double, so a large template needs only a handful of them
+        size_t capacity = block ? block->capacity * 2 : TEMPLATE_ARENA_BLOCK_SIZE;
+        if (capacity < bytes) capacity = bytes;
+        block = template_arena_block_new(capacity, arena->blocks);
+        if (!block) return nullptr;
+        arena->blocks = block;
+    }
+    void *p = template_arena_block_data(block) + block->used;
+    block->used += bytes;
+    memset(p, 0, bytes);
+    return p;
+}
+
+/**
+ * @brief Releases everything allocated from the arena at once. When the last template spilled over
+ * several blocks, they are replaced by one block large enough for all of it.
+ */
+static void template_arena_reset(TemplateArena *arena) {
+    if (!arena || !arena->blocks) return;
+    if (!arena->blocks->next) {
+        arena->blocks->used = 0;
+        return;
+    }
+
+    size_t total = 0;
+    for (TemplateArenaBlock *block = arena->blocks; block;) {
+        TemplateArenaBlock *next = block->next;
+        total += block->used;
+        free(block);
+        block = next;
+    }
+    // On failure the next allocation simply starts over with a fresh block
+    arena->blocks = template_arena_block_new(total > TEMPLATE_ARENA_BLOCK_SIZE ? total : TEMPLATE_ARENA_BLOCK_SIZE,
+                                             nullptr);
+}
+
+static void template_arena_free(TemplateArena *arena) {
+    if (!arena) return;
+    for (TemplateArenaBlock *block = arena->blocks; block;) {
+        TemplateArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
 /**
  * @brief Parses linked goals and mode from a JSON object into C arrays.
- * Used for stat auto-completion. Allocates linked_goals array with calloc.
+ * Used for stat auto-completion. Allocates linked_goals array from the template arena.
  */
-static void parse_runtime_linked_goals(cJSON *json_obj, int *out_count, CounterLinkedGoal **out_goals,
+static void parse_runtime_linked_goals(TemplateArena *arena, cJSON *json_obj, int *out_count,
+                                       CounterLinkedGoal **out_goals,
                                        LinkedGoalMode *out_mode) {
     *out_count = 0;
     *out_goals = nullptr;
@@ -1682,7 +2121,7 @@ static void parse_runtime_linked_goals(cJSON *json_obj, int *out_count, CounterL
     int count = cJSON_GetArraySize(linked_json);
     if (count <= 0) return;
 
-    *out_goals = (CounterLinkedGoal *) calloc(count, sizeof(CounterLinkedGoal));
+    *out_goals = (CounterLinkedGoal *) template_arena_calloc(arena, count, sizeof(CounterLinkedGoal));
     if (!*out_goals) return;
     *out_count = count;
 
@@ -1737,6 +2176,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
                                      int *count, int *total_criteria_count, const char *lang_key_prefix,
                                      bool is_stat_category, MC_Version version, const AppSettings *settings) {
     (void) settings;
+    TemplateArena *arena = t->template_data->arena;
     if (!category_json) {
         log_message(LOG_INFO, "[TRACKER] tracker_parse_categories: category_json is nullptr\n");
 
@@ -1747,7 +2187,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
     for (cJSON *i = category_json->child; i != nullptr; i = i->next) (*count)++;
     if (*count == 0) return;
 
-    *categories_array = (TrackableCategory **) calloc(*count, sizeof(TrackableCategory *));
+    *categories_array = (TrackableCategory **) template_arena_calloc(arena, *count, sizeof(TrackableCategory *));
     if (!*categories_array) return;
 
     cJSON *cat_json = category_json->child;
@@ -1755,7 +2195,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
     *total_criteria_count = 0;
 
     while (cat_json) {
-        TrackableCategory *new_cat = (TrackableCategory *) calloc(1, sizeof(TrackableCategory));
+        TrackableCategory *new_cat = (TrackableCategory *) template_arena_calloc(arena, 1, sizeof(TrackableCategory));
         if (!new_cat) {
             cat_json = cat_json->next;
             continue;
@@ -1786,8 +2226,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
             new_cat->root_name[sizeof(new_cat->root_name) - 1] = '\0';
         } else {
             log_message(LOG_ERROR, "[TRACKER] PARSE ERROR: Found a JSON item with a nullptr key. Skipping.\n");
-            free(new_cat);
-            new_cat = nullptr;
+            new_cat = nullptr; // Left to the arena
             cat_json = cat_json->next;
             continue;
         }
@@ -1859,10 +2298,11 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
 
             for (cJSON *c = criteria_obj->child; c != nullptr; c = c->next) new_cat->criteria_count++;
             if (new_cat->criteria_count > 0) {
-                new_cat->criteria = (TrackableItem **) calloc(new_cat->criteria_count, sizeof(TrackableItem *));
+                new_cat->criteria = (TrackableItem **) template_arena_calloc(arena, new_cat->criteria_count,
+                                                                             sizeof(TrackableItem *));
                 int k = 0;
                 for (cJSON *crit_item = criteria_obj->child; crit_item != nullptr; crit_item = crit_item->next) {
-                    TrackableItem *new_crit = (TrackableItem *) calloc(1, sizeof(TrackableItem));
+                    TrackableItem *new_crit = (TrackableItem *) template_arena_calloc(arena, 1, sizeof(TrackableItem));
                     if (new_crit) {
                         // Initialization for animation state
                         new_crit->alpha = 1.0f;
@@ -1943,7 +2383,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
 
                         // Parse sub-stat linked goals for auto-completion
                         if (is_stat_category) {
-                            parse_runtime_linked_goals(crit_item, &new_crit->linked_goal_count,
+                            parse_runtime_linked_goals(arena, crit_item, &new_crit->linked_goal_count,
                                                        &new_crit->linked_goals, &new_crit->linked_goal_mode);
                         }
 
@@ -1977,9 +2417,10 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
             new_cat->criteria_count = 1;
             new_cat->criteria_progress_total = 1;
             *total_criteria_count += 1;
-            new_cat->criteria = (TrackableItem **) calloc(new_cat->criteria_count, sizeof(TrackableItem *));
+            new_cat->criteria = (TrackableItem **) template_arena_calloc(arena, new_cat->criteria_count,
+                                                                         sizeof(TrackableItem *));
             if (new_cat->criteria_count) {
-                TrackableItem *the_criterion = (TrackableItem *) calloc(1, sizeof(TrackableItem));
+                TrackableItem *the_criterion = (TrackableItem *) template_arena_calloc(arena, 1, sizeof(TrackableItem));
                 if (the_criterion) {
                     // This single criterion inherits properties from its parent category
                     cJSON *crit_root_name_json = cJSON_GetObjectItem(cat_json, "root_name");
@@ -2019,7 +2460,7 @@ static void tracker_parse_categories(Tracker *t, cJSON *category_json, cJSON *la
 
         // Parse stat category linked goals for auto-completion
         if (is_stat_category) {
-            parse_runtime_linked_goals(cat_json, &new_cat->linked_goal_count,
+            parse_runtime_linked_goals(arena, cat_json, &new_cat->linked_goal_count,
                                        &new_cat->linked_goals, &new_cat->linked_goal_mode);
         }
 
@@ -2213,7 +2654,7 @@ static void tracker_parse_simple_trackables(Tracker *t, cJSON *category_json, cJ
                                             int *count, const char *lang_key_prefix, const AppSettings *settings,
                                             bool parse_linked) {
     (void) settings;
-    (void) t;
+    TemplateArena *arena = t->template_data->arena;
     if (!category_json) {
         log_message(LOG_INFO, "[TRACKER] tracker_parse_simple_trackables: category_json is nullptr\n");
 
@@ -2226,13 +2667,13 @@ static void tracker_parse_simple_trackables(Tracker *t, cJSON *category_json, cJ
         return;
     }
 
-    *items_array = (TrackableItem **) calloc(*count, sizeof(TrackableItem *));
+    *items_array = (TrackableItem **) template_arena_calloc(arena, *count, sizeof(TrackableItem *));
     if (!*items_array) return;
 
     cJSON *item_json = nullptr;
     int i = 0;
     cJSON_ArrayForEach(item_json, category_json) {
-        TrackableItem *new_item = (TrackableItem *) calloc(1, sizeof(TrackableItem));
+        TrackableItem *new_item = (TrackableItem *) template_arena_calloc(arena, 1, sizeof(TrackableItem));
         if (new_item) {
             new_item->alpha = 1.0f;
             new_item->is_visible_on_overlay = true;
@@ -2251,8 +2692,7 @@ static void tracker_parse_simple_trackables(Tracker *t, cJSON *category_json, cJ
                 strncpy(new_item->root_name, root_name_json->valuestring, sizeof(new_item->root_name) - 1);
                 new_item->root_name[sizeof(new_item->root_name) - 1] = '\0';
             } else {
-                // Skip this item if it has no root_name
-                free(new_item);
+                // Skip this item if it has no root_name (its memory is left to the arena)
                 new_item = nullptr;
                 continue;
             }
@@ -2300,7 +2740,7 @@ static void tracker_parse_simple_trackables(Tracker *t, cJSON *category_json, cJ
 
             // Parse linked goals for manual custom goals (goal <= 0)
             if (parse_linked && new_item->goal <= 0) {
-                parse_runtime_linked_goals(item_json, &new_item->linked_goal_count,
+                parse_runtime_linked_goals(arena, item_json, &new_item->linked_goal_count,
                                            &new_item->linked_goals, &new_item->linked_goal_mode);
             }
 
@@ -2326,9 +2766,9 @@ static void tracker_parse_simple_trackables(Tracker *t, cJSON *category_json, cJ
 static void tracker_parse_multi_stage_goals(Tracker *t, cJSON *goals_json, cJSON *lang_json,
                                             MultiStageGoal ***goals_array,
                                             int *count, const AppSettings *settings) {
-    (void) t;
     (void) lang_json;
     (void) settings;
+    TemplateArena *arena = t->template_data->arena;
     if (!goals_json) {
         log_message(LOG_INFO, "[TRACKER] tracker_parse_multi_stage_goals: goals_json is nullptr\n");
 
@@ -2345,7 +2785,7 @@ static void tracker_parse_multi_stage_goals(Tracker *t, cJSON *goals_json, cJSON
         return;
     }
 
-    *goals_array = (MultiStageGoal **) calloc(*count, sizeof(MultiStageGoal *));
+    *goals_array = (MultiStageGoal **) template_arena_calloc(arena, *count, sizeof(MultiStageGoal *));
     if (!*goals_array) {
         log_message(LOG_ERROR, "[TRACKER] Failed to allocate memory for MultiStageGoal array.\n");
         *count = 0;
@@ -2356,7 +2796,7 @@ static void tracker_parse_multi_stage_goals(Tracker *t, cJSON *goals_json, cJSON
     int i = 0;
     cJSON_ArrayForEach(goal_item_json, goals_json) {
         // Iterate through each goal
-        MultiStageGoal *new_goal = (MultiStageGoal *) calloc(1, sizeof(MultiStageGoal));
+        MultiStageGoal *new_goal = (MultiStageGoal *) template_arena_calloc(arena, 1, sizeof(MultiStageGoal));
         if (!new_goal) continue;
 
         // Initialization for animation state
@@ -2419,17 +2859,16 @@ static void tracker_parse_multi_stage_goals(Tracker *t, cJSON *goals_json, cJSON
         new_goal->stage_count = cJSON_GetArraySize(stages_json);
         if (new_goal->stage_count > 0) {
             // Allocate memory for the stages array
-            new_goal->stages = (SubGoal **) calloc(new_goal->stage_count, sizeof(SubGoal *));
+            new_goal->stages = (SubGoal **) template_arena_calloc(arena, new_goal->stage_count, sizeof(SubGoal *));
             if (!new_goal->stages) {
-                free(new_goal);
-                new_goal = nullptr;
+                new_goal = nullptr; // Left to the arena
                 continue;
             }
 
             cJSON *stage_item_json = nullptr;
             int j = 0;
             cJSON_ArrayForEach(stage_item_json, stages_json) {
-                SubGoal *new_stage = (SubGoal *) calloc(1, sizeof(SubGoal));
+                SubGoal *new_stage = (SubGoal *) template_arena_calloc(arena, 1, sizeof(SubGoal));
                 if (!new_stage) continue;
 
                 // parse stage_id and other properties
@@ -2513,7 +2952,7 @@ static void tracker_parse_multi_stage_goals(Tracker *t, cJSON *goals_json, cJSON
                 }
                 // Parse stage linked goals for auto-completion (non-final stages)
                 if (new_stage->type != SUBGOAL_MANUAL) {
-                    parse_runtime_linked_goals(stage_item_json, &new_stage->linked_goal_count,
+                    parse_runtime_linked_goals(arena, stage_item_json, &new_stage->linked_goal_count,
                                                &new_stage->linked_goals, &new_stage->linked_goal_mode);
                 }
 
@@ -2539,6 +2978,7 @@ static void tracker_parse_counter_goals(Tracker *t, cJSON *counters_json, cJSON
                                         CounterGoal ***goals_array, int *count,
                                         const AppSettings *settings) {
     (void) settings;
+    TemplateArena *arena = t->template_data->arena;
     if (!counters_json) {
         *count = 0;
         return;
@@ -2547,7 +2987,7 @@ static void tracker_parse_counter_goals(Tracker *t, cJSON *counters_json, cJSON
     *count = cJSON_GetArraySize(counters_json);
     if (*count == 0) return;
 
-    *goals_array = (CounterGoal **) calloc(*count, sizeof(CounterGoal *));
+    *goals_array = (CounterGoal **) template_arena_calloc(arena, *count, sizeof(CounterGoal *));
     if (!*goals_array) {
         log_message(LOG_ERROR, "[TRACKER] Failed to allocate memory for CounterGoal array.\n");
         *count = 0;
@@ -2557,7 +2997,7 @@ static void tracker_parse_counter_goals(Tracker *t, cJSON *counters_json, cJSON
     cJSON *goal_item_json = nullptr;
     int i = 0;
     cJSON_ArrayForEach(goal_item_json, counters_json) {
-        CounterGoal *new_goal = (CounterGoal *) calloc(1, sizeof(CounterGoal));
+        CounterGoal *new_goal = (CounterGoal *) template_arena_calloc(arena, 1, sizeof(CounterGoal));
         if (!new_goal) continue;
 
         new_goal->alpha = 1.0f;
@@ -2610,7 +3050,8 @@ static void tracker_parse_counter_goals(Tracker *t, cJSON *counters_json, cJSON
         cJSON *linked_json = cJSON_GetObjectItem(goal_item_json, "linked_goals");
         int linked_count = cJSON_GetArraySize(linked_json);
         if (linked_count > 0) {
-            new_goal->linked_goals = (CounterLinkedGoal *) calloc(linked_count, sizeof(CounterLinkedGoal));
+            new_goal->linked_goals = (CounterLinkedGoal *) template_arena_calloc(arena, linked_count,
+                                                                                 sizeof(CounterLinkedGoal));
             if (new_goal->linked_goals) {
                 new_goal->linked_goal_count = linked_count;
                 cJSON *link_json = nullptr;
@@ -2650,12 +3091,13 @@ static void tracker_parse_counter_goals(Tracker *t, cJSON *counters_json, cJSON
  * Decorations are manual layout elements like text headers, lines, and arrows.
  * They are only rendered when manual layout mode is active.
  *
+ * @param arena The template arena the decorations are allocated from.
  * @param decorations_json The cJSON array for the "decorations" key from the template file.
  * @param lang_json The cJSON object from the language file.
  * @param decorations_array A pointer to the array of DecorationElement pointers to be populated.
  * @param count A pointer to an integer that will store the number of decorations parsed.
  */
-static void tracker_parse_decorations(cJSON *decorations_json, cJSON *lang_json,
+static void tracker_parse_decorations(TemplateArena *arena, cJSON *decorations_json, cJSON *lang_json,
                                       DecorationElement ***decorations_array, int *count) {
     if (!decorations_json) {
         *count = 0;
@@ -2668,11 +3110,11 @@ static void tracker_parse_decorations(cJSON *decorations_json, cJSON *lang_json,
         return;
     }
 
-    *decorations_array = (DecorationElement **) calloc(*count, sizeof(DecorationElement *));
+    *decorations_array = (DecorationElement **) template_arena_calloc(arena, *count, sizeof(DecorationElement *));
     int i = 0;
     cJSON *item_json = nullptr;
     cJSON_ArrayForEach(item_json, decorations_json) {
-        auto *elem = (DecorationElement *) calloc(1, sizeof(DecorationElement));
+        auto *elem = (DecorationElement *) template_arena_calloc(arena, 1, sizeof(DecorationElement));
 
         // Parse ID
         cJSON *id_json = cJSON_GetObjectItem(item_json, "id");
@@ -2716,7 +3158,8 @@ static void tracker_parse_decorations(cJSON *decorations_json, cJSON *lang_json,
             cJSON *linked_json = cJSON_GetObjectItem(item_json, "linked_goals");
             int linked_count = cJSON_GetArraySize(linked_json);
             if (linked_count > 0) {
-                elem->linked_goals = (CounterLinkedGoal *) calloc(linked_count, sizeof(CounterLinkedGoal));
+                elem->linked_goals = (CounterLinkedGoal *) template_arena_calloc(arena, linked_count,
+                                                                                 sizeof(CounterLinkedGoal));
                 if (elem->linked_goals) {
                     elem->linked_goal_count = linked_count;
                     cJSON *lg_json = nullptr;
@@ -3143,6 +3586,249 @@ static bool is_goal_completed_by_root(const TemplateData *td, const char *root_n
     return false;
 }
 
+// Goal identifiers interned once per template load: every goal root name and stage id the template
+// defines maps to one 32-bit id (0 = the empty string, i.e. an unset parent_root or stage_id). The load-time
+// linked-goal resolver and the per-click co-op mod lookups compare these ids instead of strings. Only
+// categories and items keep theirs (root_sid), as those are the goals the mod lookups scan.
+struct StringPool {
+    std::unordered_map<std::string, uint32_t> ids;
+};
+
+static void string_pool_free(StringPool *pool) {
+    delete pool;
+}
+
+static uint32_t string_pool_intern(StringPool *pool, const char *s) {
+    if (!s || s[0] == '\0') return 0;
+    return pool->ids.emplace(s, (uint32_t) pool->ids.size() + 1).first->second;
+}
+
+// Looks a name up without interning it. Returns 0 for the empty string and for names the template lacks.
+static uint32_t string_pool_find(const StringPool *pool, const char *s) {
+    if (!pool || !s || s[0] == '\0') return 0;
+    auto it = pool->ids.find(s);
+    return it == pool->ids.end() ? 0 : it->second;
+}
+
+/**
+ * @brief Interns the goal root names and stage ids of the whole template into TemplateData::string_pool.
+ * Called once the template is fully parsed, before anything resolves by id.
+ */
+static void tracker_intern_template_names(TemplateData *td) {
+    string_pool_free(td->string_pool);
+    StringPool *pool = new StringPool();
+
+    TrackableCategory **category_lists[] = {td->advancements, td->stats};
+    int category_counts[] = {td->advancement_count, td->stat_count};
+    for (int l = 0; l < 2; l++) {
+        for (int j = 0; j < category_counts[l]; j++) {
+            TrackableCategory *cat = category_lists[l][j];
+            if (!cat) continue;
+            cat->root_sid = string_pool_intern(pool, cat->root_name);
+            for (int k = 0; k < cat->criteria_count; k++) {
+                TrackableItem *crit = cat->criteria[k];
+                if (crit) crit->root_sid = string_pool_intern(pool, crit->root_name);
+            }
+        }
+    }
+    for (int j = 0; j < td->unlock_count; j++) {
+        if (td->unlocks[j]) td->unlocks[j]->root_sid = string_pool_intern(pool, td->unlocks[j]->root_name);
+    }
+    for (int j = 0; j < td->custom_goal_count; j++) {
+        TrackableItem *goal = td->custom_goals[j];
+        if (goal) goal->root_sid = string_pool_intern(pool, goal->root_name);
+    }
+    for (int j = 0; j < td->multi_stage_goal_count; j++) {
+        MultiStageGoal *msg = td->multi_stage_goals[j];
+        if (!msg) continue;
+        string_pool_intern(pool, msg->root_name);
+        for (int k = 0; k < msg->stage_count; k++) {
+            if (msg->stages[k]) string_pool_intern(pool, msg->stages[k]->stage_id);
+        }
+    }
+    for (int j = 0; j < td->counter_goal_count; j++) {
+        if (td->counter_goals[j]) string_pool_intern(pool, td->counter_goals[j]->root_name);
+    }
+    td->string_pool = pool;
+}
+
+// Every goal a linked goal can name, per section, keyed the way is_goal_completed_by_root() matches:
+// (0, root) for a lookup without parent_root (or stage_id for multi-stage goals), (parent, root) for a
+// criterion or sub-stat under a specific parent ((root, stage) for a multi-stage stage), all interned ids.
+// Entries are inserted in the legacy search order and never overwritten, so the first match still wins.
+struct LinkedGoalTarget {
+    const bool *done;
+    const MultiStageGoal *msg;
+    int stage;
+};
+
+typedef std::unordered_map<uint64_t, LinkedGoalTarget> LinkedGoalSection;
+
+static uint64_t linked_goal_key(uint32_t outer_sid, uint32_t sid) {
+    return ((uint64_t) outer_sid << 32) | sid;
+}
+
+static void linked_goal_index_add(LinkedGoalSection &section, uint64_t key, LinkedGoalTarget target) {
+    section.emplace(key, target); // Keeps an existing entry: the earlier goal is the one the search finds
+}
+
+static void linked_goal_index_add_categories(LinkedGoalSection &section, TrackableCategory **cats, int count) {
+    for (int j = 0; j < count; j++) {
+        TrackableCategory *cat = cats[j];
+        if (!cat) continue;
+        linked_goal_index_add(section, linked_goal_key(0, cat->root_sid), {&cat->done, nullptr, -1});
+        for (int k = 0; k < cat->criteria_count; k++) {
+            TrackableItem *crit = cat->criteria[k];
+            if (!crit) continue;
+            linked_goal_index_add(section, linked_goal_key(0, crit->root_sid), {&crit->done, nullptr, -1});
+            linked_goal_index_add(section, linked_goal_key(cat->root_sid, crit->root_sid),
+                                  {&crit->done, nullptr, -1});
+        }
+    }
+}
+
+// A link's names as pool ids. UINT32_MAX stands for a non-empty name the template doesn't define, which
+// matches no key, so such a link stays unresolved instead of dropping its parent_root or stage_id.
+struct LinkedGoalIds {
+    uint32_t root;
+    uint32_t parent;
+    uint32_t stage;
+};
+
+static uint32_t linked_goal_name_id(const StringPool *pool, const char *s) {
+    if (s[0] == '\0') return 0;
+    uint32_t sid = string_pool_find(pool, s);
+    return sid != 0 ? sid : UINT32_MAX;
+}
+
+// Finds a link's target in one section. Only advancements and stats honor parent_root and only
+// multi-stage goals honor stage_id, like the name search.
+static const LinkedGoalTarget *linked_goal_index_find(const LinkedGoalSection *sections, LinkedGoalType type,
+                                                      const LinkedGoalIds &ids) {
+    const LinkedGoalSection &section = sections[type];
+    uint64_t key = linked_goal_key(0, ids.root);
+    if ((type == LINK_TYPE_ADVANCEMENT || type == LINK_TYPE_STAT) && ids.parent != 0) {
+        key = linked_goal_key(ids.parent, ids.root);
+    } else if (type == LINK_TYPE_MULTI_STAGE && ids.stage != 0) {
+        key = linked_goal_key(ids.root, ids.stage);
+    }
+    auto it = section.find(key);
+    return it == section.end() ? nullptr : &it->second;
+}
+
+/**
+ * @brief Resolves every linked goal in the template to a direct pointer at its target, so
+ * tracker_propagate_linked_goals() evaluates each link in O(1) instead of searching the
+ * whole template by name. Called once the template is fully parsed and interned; goals aren't added
+ * or freed until the next load, so the pointers stay valid for the template's lifetime.
+ */
+static void tracker_resolve_linked_goals(TemplateData *td) {
+    if (!td) return;
+
+    const StringPool *pool = td->string_pool;
+    LinkedGoalSection sections[LINK_TYPE_COUNTER + 1];
+    linked_goal_index_add_categories(sections[LINK_TYPE_ADVANCEMENT], td->advancements, td->advancement_count);
+    linked_goal_index_add_categories(sections[LINK_TYPE_STAT], td->stats, td->stat_count);
+    for (int j = 0; j < td->unlock_count; j++) {
+        if (td->unlocks[j])
+            linked_goal_index_add(sections[LINK_TYPE_UNLOCK], linked_goal_key(0, td->unlocks[j]->root_sid),
+                                  {&td->unlocks[j]->done, nullptr, -1});
+    }
+    for (int j = 0; j < td->custom_goal_count; j++) {
+        if (td->custom_goals[j])
+            linked_goal_index_add(sections[LINK_TYPE_CUSTOM], linked_goal_key(0, td->custom_goals[j]->root_sid),
+                                  {&td->custom_goals[j]->done, nullptr, -1});
+    }
+    for (int j = 0; j < td->multi_stage_goal_count; j++) {
+        MultiStageGoal *msg = td->multi_stage_goals[j];
+        if (!msg) continue;
+        uint32_t msg_sid = string_pool_find(pool, msg->root_name);
+        linked_goal_index_add(sections[LINK_TYPE_MULTI_STAGE], linked_goal_key(0, msg_sid), {nullptr, msg, -1});
+        for (int k = 0; k < msg->stage_count; k++) {
+            if (msg->stages[k])
+                linked_goal_index_add(sections[LINK_TYPE_MULTI_STAGE],
+                                      linked_goal_key(msg_sid, string_pool_find(pool, msg->stages[k]->stage_id)),
+                                      {nullptr, msg, k});
+        }
+    }
+    for (int j = 0; j < td->counter_goal_count; j++) {
+        if (td->counter_goals[j])
+            linked_goal_index_add(sections[LINK_TYPE_COUNTER],
+                                  linked_goal_key(0, string_pool_find(pool, td->counter_goals[j]->root_name)),
+                                  {&td->counter_goals[j]->done, nullptr, -1});
+    }
+
+    int unresolved = 0;
+    auto resolve = [&](CounterLinkedGoal *goals, int count) {
+        for (int j = 0; goals && j < count; j++) {
+            CounterLinkedGoal *lg = &goals[j];
+            const LinkedGoalTarget *target = nullptr;
+            LinkedGoalIds ids = {linked_goal_name_id(pool, lg->root_name), linked_goal_name_id(pool, lg->parent_root),
+                                 linked_goal_name_id(pool, lg->stage_id)};
+            if (ids.root != 0 && ids.root != UINT32_MAX) {
+                if (lg->type != LINK_TYPE_ANY) {
+                    target = linked_goal_index_find(sections, lg->type, ids);
+                } else {
+                    // Legacy search order: advancements, stats, unlocks, custom, multi-stage, counters
+                    for (int type = LINK_TYPE_ADVANCEMENT; type <= LINK_TYPE_COUNTER && !target; type++) {
+                        target = linked_goal_index_find(sections, (LinkedGoalType) type, ids);
+                    }
+                }
+            }
+            lg->resolved = true;
+            lg->resolved_done = target ? target->done : nullptr;
+            lg->resolved_msg = target ? target->msg : nullptr;
+            lg->resolved_stage = target ? target->stage : -1;
+            if (!target) unresolved++;
+        }
+    };
+
+    TrackableCategory **category_lists[] = {td->advancements, td->stats};
+    int category_counts[] = {td->advancement_count, td->stat_count};
+    for (int l = 0; l < 2; l++) {
+        for (int j = 0; j < category_counts[l]; j++) {
+            TrackableCategory *cat = category_lists[l][j];
+            if (!cat) continue;
+            resolve(cat->linked_goals, cat->linked_goal_count);
+            for (int k = 0; k < cat->criteria_count; k++) {
+                if (cat->criteria[k]) resolve(cat->criteria[k]->linked_goals, cat->criteria[k]->linked_goal_count);
+            }
+        }
+    }
+    for (int j = 0; j < td->unlock_count; j++) {
+        if (td->unlocks[j]) resolve(td->unlocks[j]->linked_goals, td->unlocks[j]->linked_goal_count);
+    }
+    for (int j = 0; j < td->custom_goal_count; j++) {
+        if (td->custom_goals[j]) resolve(td->custom_goals[j]->linked_goals, td->custom_goals[j]->linked_goal_count);
+    }
+    for (int j = 0; j < td->multi_stage_goal_count; j++) {
+        MultiStageGoal *msg = td->multi_stage_goals[j];
+        if (!msg) continue;
+        for (int k = 0; k < msg->stage_count; k++) {
+            if (msg->stages[k]) resolve(msg->stages[k]->linked_goals, msg->stages[k]->linked_goal_count);
+        }
+    }
+    for (int j = 0; j < td->counter_goal_count; j++) {
+        if (td->counter_goals[j]) resolve(td->counter_goals[j]->linked_goals, td->counter_goals[j]->linked_goal_count);
+    }
+
+    if (unresolved > 0) {
+        log_message(LOG_INFO, "[TRACKER] %d linked goal(s) point at goals missing from the template.\n", unresolved);
+    }
+}
+
+// Whether a linked goal's target is completed, through its resolved pointer when it has one.
+static bool is_linked_goal_completed(const TemplateData *td, const CounterLinkedGoal *lg) {
+    if (!lg->resolved) {
+        return is_goal_completed_by_root(td, lg->root_name, lg->stage_id, lg->parent_root, lg->type);
+    }
+    if (lg->resolved_msg) {
+        if (lg->resolved_stage < 0) return lg->resolved_msg->current_stage >= lg->resolved_msg->stage_count - 1;
+        return lg->resolved_msg->current_stage > lg->resolved_stage;
+    }
+    return lg->resolved_done && *lg->resolved_done;
+}
+
 /**
  * @brief Checks if linked goals are satisfied based on mode (AND/OR).
  * Returns true if auto-completion should trigger.
@@ -3154,9 +3840,7 @@ static bool check_linked_goals_satisfied(const TemplateData *td, const CounterLi
     if (mode == LINKED_GOAL_AND) {
         // All linked goals must be completed
         for (int j = 0; j < linked_goal_count; j++) {
-            if (!is_goal_completed_by_root(td, linked_goals[j].root_name,
-                                           linked_goals[j].stage_id, linked_goals[j].parent_root,
-                                           linked_goals[j].type)) {
+            if (!is_linked_goal_completed(td, &linked_goals[j])) {
                 return false; // any goal not completed
             }
         }
@@ -3164,9 +3848,7 @@ static bool check_linked_goals_satisfied(const TemplateData *td, const CounterLi
     } else {
         // At least one linked goal must be completed (OR mode)
         for (int j = 0; j < linked_goal_count; j++) {
-            if (is_goal_completed_by_root(td, linked_goals[j].root_name,
-                                          linked_goals[j].stage_id, linked_goals[j].parent_root,
-                                          linked_goals[j].type)) {
+            if (is_linked_goal_completed(td, &linked_goals[j])) {
                 return true; // any goal completed
             }
         }
@@ -3206,10 +3888,12 @@ static int ms_compute_current_stage(MultiStageGoal *goal, std::vector<bool> &bas
  * @param player_stats_json The parsed player stats JSON file.
  * @param player_unlocks_json The parsed player unlocks JSON file.
  * @param version The game version from the MC_Version enum.
+ * @param stats_index The indexed player stats file (1.13+), used for modern stat stages.
  */
 static bool tracker_update_multi_stage_progress(Tracker *t, const cJSON *player_adv_json,
                                                 const cJSON *player_stats_json, const cJSON *player_unlocks_json,
-                                                MC_Version version, const AppSettings *settings) {
+                                                MC_Version version, const AppSettings *settings,
+                                                ModernStatsIndex *stats_index) {
     (void) settings;
     if (t->template_data->multi_stage_goal_count == 0) return false;
 
@@ -3335,25 +4019,10 @@ static bool tracker_update_multi_stage_progress(Tracker *t, const cJSON *player_
                             stat_found = true;
                         }
                     } else {
-                        // MODERN ERA: Parse directly from the nested "stats" object
-                        cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
-                        if (stats_obj) {
-                            char root_name_copy[192];
-                            strncpy(root_name_copy, stage_to_check->root_name, sizeof(root_name_copy) - 1);
-                            root_name_copy[sizeof(root_name_copy) - 1] = '\0';
-                            char *item_key = strchr(root_name_copy, '/');
-                            if (item_key) {
-                                *item_key = '\0';
-                                item_key++;
-                                cJSON *category_obj = cJSON_GetObjectItem(stats_obj, root_name_copy);
-                                if (category_obj) {
-                                    cJSON *stat_value = cJSON_GetObjectItem(category_obj, item_key);
-                                    if (cJSON_IsNumber(stat_value)) {
-                                        current_progress = stat_value->valueint;
-                                        stat_found = true;
-                                    }
-                                }
-                            }
+                        // MODERN ERA: "category/item" root_name, resolved through the per-read stats index
+                        if (strchr(stage_to_check->root_name, '/') &&
+                            modern_stats_index_find(stats_index, stage_to_check->root_name, &current_progress)) {
+                            stat_found = true;
                         }
                     }
 
@@ -3427,7 +4096,7 @@ static bool tracker_update_multi_stage_progress(Tracker *t, const cJSON *player_
 
             // Base satisfaction for this stage: own game trigger OR linked goals. The
             // "complete with next stage" rule is applied afterwards by ms_compute_current_stage.
-            // Chains of linked goals resolve through the fixed-point iteration in the caller.
+            // Chains of linked goals settle in the caller's tracker_propagate_linked_goals().
             base_satisfied[j] = stage_completed ||
                                 (stage_to_check->linked_goal_count > 0 &&
                                  check_linked_goals_satisfied(t->template_data, stage_to_check->linked_goals,
@@ -3442,9 +4111,23 @@ static bool tracker_update_multi_stage_progress(Tracker *t, const cJSON *player_
     return any_changed;
 }
 
+// Completes one manual custom goal (goal <= 0) once its linked goals are satisfied. True if it changed.
+static bool custom_goal_apply_linked_goals(const TemplateData *td, TrackableItem *cg) {
+    if (!cg || cg->goal > 0) return false; // Only manual goals (toggle / infinite counter)
+    if (cg->linked_goal_count > 0 && !cg->done) {
+        if (check_linked_goals_satisfied(td, cg->linked_goals,
+                                         cg->linked_goal_count, cg->linked_goal_mode)) {
+            cg->done = true;
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * @brief Updates completion of manual custom goals (goal <= 0) via linked goals.
- * Returns true if any goal was newly completed this call (used for fixed-point iteration).
+ * Returns true if any goal was newly completed this call. Only tracker_propagate_linked_goals()' fallback
+ * without a compiled graph sweeps every goal like this; the graph re-evaluates just the dirty frontier.
  */
 static bool tracker_update_custom_goal_linked_goals(Tracker *t) {
     if (!t || !t->template_data) return false;
@@ -3452,22 +4135,31 @@ static bool tracker_update_custom_goal_linked_goals(Tracker *t) {
     bool any_changed = false;
 
     for (int i = 0; i < td->custom_goal_count; i++) {
-        TrackableItem *cg = td->custom_goals[i];
-        if (!cg || cg->goal > 0) continue; // Only manual goals (toggle / infinite counter)
-        if (cg->linked_goal_count > 0 && !cg->done) {
-            if (check_linked_goals_satisfied(td, cg->linked_goals,
-                                             cg->linked_goal_count, cg->linked_goal_mode)) {
-                cg->done = true;
-                any_changed = true;
-            }
-        }
+        any_changed |= custom_goal_apply_linked_goals(td, td->custom_goals[i]);
     }
     return any_changed;
 }
 
+// Recounts one counter's completed linked goals and its done flag. True if either changed.
+static bool counter_goal_recount(const TemplateData *td, CounterGoal *counter) {
+    if (!counter) return false;
+    int completed = 0;
+    for (int j = 0; j < counter->linked_goal_count; j++) {
+        CounterLinkedGoal *lg = &counter->linked_goals[j];
+        if (is_linked_goal_completed(td, lg)) {
+            completed++;
+        }
+    }
+    bool new_done = (counter->linked_goal_count > 0 && completed >= counter->linked_goal_count);
+    bool changed = (counter->completed_count != completed || counter->done != new_done);
+    counter->completed_count = completed;
+    counter->done = new_done;
+    return changed;
+}
+
 /**
  * @brief Updates completion state of all counter goals by checking their linked goals.
- * Returns true if any counter changed state (used for fixed-point iteration).
+ * Returns true if any counter changed state (tracker_propagate_linked_goals()' graph-less fallback).
  * Must be called before tracker_calculate_overall_progress.
  */
 static bool tracker_update_counter_goals(Tracker *t) {
@@ -3475,123 +4167,448 @@ static bool tracker_update_counter_goals(Tracker *t) {
     TemplateData *td = t->template_data;
     bool any_changed = false;
     for (int i = 0; i < td->counter_goal_count; i++) {
-        CounterGoal *counter = td->counter_goals[i];
-        if (!counter) continue;
-        int completed = 0;
-        for (int j = 0; j < counter->linked_goal_count; j++) {
-            CounterLinkedGoal *lg = &counter->linked_goals[j];
-            if (is_goal_completed_by_root(td, lg->root_name, lg->stage_id, lg->parent_root, lg->type)) {
-                completed++;
-            }
-        }
-        bool new_done = (counter->linked_goal_count > 0 && completed >= counter->linked_goal_count);
-        if (counter->completed_count != completed || counter->done != new_done) any_changed = true;
-        counter->completed_count = completed;
-        counter->done = new_done;
+        any_changed |= counter_goal_recount(td, td->counter_goals[i]);
     }
     return any_changed;
 }
 
-/**
- * @brief Updates stat completion based on linked goals (auto-completion).
- * Returns true if any stat or sub-stat was newly completed this call (used for fixed-point iteration).
- */
-static bool tracker_update_stat_linked_goals(Tracker *t) {
-    if (!t || !t->template_data) return false;
-    TemplateData *td = t->template_data;
+// Auto-completes one stat and its sub-stats from their linked goals. True if any was newly completed.
+static bool stat_apply_linked_goals(const TemplateData *td, TrackableCategory *stat_cat) {
+    if (!stat_cat) return false;
     bool any_changed = false;
 
-    // Reset stat completion counts to recalculate with linked goals
-    td->stats_completed_count = 0;
-    td->stats_completed_criteria_count = 0;
-
-    for (int i = 0; i < td->stat_count; i++) {
-        TrackableCategory *stat_cat = td->stats[i];
-        if (!stat_cat) continue;
-
-        // Check sub-stat linked goals
-        stat_cat->completed_criteria_count = 0;
-        for (int j = 0; j < stat_cat->criteria_count; j++) {
-            TrackableItem *sub_stat = stat_cat->criteria[j];
-            if (!sub_stat) continue;
-
-            // If sub-stat has linked goals and they are satisfied, auto-complete it
-            if (sub_stat->linked_goal_count > 0 && !sub_stat->done) {
-                if (check_linked_goals_satisfied(td, sub_stat->linked_goals,
-                                                 sub_stat->linked_goal_count, sub_stat->linked_goal_mode)) {
-                    sub_stat->done = true;
-                    any_changed = true;
-                }
-            }
-            if (sub_stat->done) stat_cat->completed_criteria_count++;
-        }
-
-        // Check stat category linked goals
-        if (stat_cat->linked_goal_count > 0 && !stat_cat->done) {
-            if (check_linked_goals_satisfied(td, stat_cat->linked_goals,
-                                             stat_cat->linked_goal_count, stat_cat->linked_goal_mode)) {
-                stat_cat->done = true;
+    // Check sub-stat linked goals
+    stat_cat->completed_criteria_count = 0;
+    for (int j = 0; j < stat_cat->criteria_count; j++) {
+        TrackableItem *sub_stat = stat_cat->criteria[j];
+        if (!sub_stat) continue;
+
+        // If sub-stat has linked goals and they are satisfied, auto-complete it
+        if (sub_stat->linked_goal_count > 0 && !sub_stat->done) {
+            if (check_linked_goals_satisfied(td, sub_stat->linked_goals,
+                                             sub_stat->linked_goal_count, sub_stat->linked_goal_mode)) {
+                sub_stat->done = true;
                 any_changed = true;
-                // When the category is auto-completed, mark all children done too
-                for (int j = 0; j < stat_cat->criteria_count; j++) {
-                    if (stat_cat->criteria[j] && !stat_cat->criteria[j]->done) {
-                        stat_cat->criteria[j]->done = true;
-                    }
-                }
-                stat_cat->completed_criteria_count = stat_cat->criteria_count;
             }
         }
+        if (sub_stat->done) stat_cat->completed_criteria_count++;
+    }
 
-        // Recalculate parent done if all children are now done (might have changed from sub-stat linked goals)
-        bool all_children_done = (stat_cat->criteria_count > 0 &&
-                                  stat_cat->completed_criteria_count >= stat_cat->criteria_count);
-        if (all_children_done && !stat_cat->done) {
+    // Check stat category linked goals
+    if (stat_cat->linked_goal_count > 0 && !stat_cat->done) {
+        if (check_linked_goals_satisfied(td, stat_cat->linked_goals,
+                                         stat_cat->linked_goal_count, stat_cat->linked_goal_mode)) {
             stat_cat->done = true;
             any_changed = true;
+            // When the category is auto-completed, mark all children done too
+            for (int j = 0; j < stat_cat->criteria_count; j++) {
+                if (stat_cat->criteria[j] && !stat_cat->criteria[j]->done) {
+                    stat_cat->criteria[j]->done = true;
+                }
+            }
+            stat_cat->completed_criteria_count = stat_cat->criteria_count;
         }
+    }
+
+    // Recalculate parent done if all children are now done (might have changed from sub-stat linked goals)
+    bool all_children_done = (stat_cat->criteria_count > 0 &&
+                              stat_cat->completed_criteria_count >= stat_cat->criteria_count);
+    if (all_children_done && !stat_cat->done) {
+        stat_cat->done = true;
+        any_changed = true;
+    }
+    return any_changed;
+}
 
+// Recounts each stat's completed sub-stats and the template-wide stat completion totals.
+static void tracker_count_completed_stats(TemplateData *td) {
+    td->stats_completed_count = 0;
+    td->stats_completed_criteria_count = 0;
+    for (int i = 0; i < td->stat_count; i++) {
+        TrackableCategory *stat_cat = td->stats[i];
+        if (!stat_cat) continue;
+        stat_cat->completed_criteria_count = 0;
+        for (int j = 0; j < stat_cat->criteria_count; j++) {
+            if (stat_cat->criteria[j] && stat_cat->criteria[j]->done) stat_cat->completed_criteria_count++;
+        }
         if (stat_cat->done) td->stats_completed_count++;
         td->stats_completed_criteria_count += stat_cat->completed_criteria_count;
     }
+}
+
+/**
+ * @brief Updates stat completion based on linked goals (auto-completion), then the stat totals.
+ * Returns true if any stat or sub-stat was newly completed this call (tracker_propagate_linked_goals()'
+ * graph-less fallback).
+ */
+static bool tracker_update_stat_linked_goals(Tracker *t) {
+    if (!t || !t->template_data) return false;
+    TemplateData *td = t->template_data;
+    bool any_changed = false;
+
+    for (int i = 0; i < td->stat_count; i++) {
+        any_changed |= stat_apply_linked_goals(td, td->stats[i]);
+    }
+    tracker_count_completed_stats(td);
     return any_changed;
 }
 
+// Whether a stage's own game trigger is met. Stat stages re-derive live (Hermes/full updates keep
+// current_stat_progress accurate); other stage types rely on the stored game_trigger_met flag.
+static bool ms_stage_game_met(const SubGoal *stage) {
+    return (stage->type == SUBGOAL_STAT)
+               ? (stage->required_progress > 0 && stage->current_stat_progress >= stage->required_progress)
+               : stage->game_trigger_met;
+}
+
+// Re-derives one multi-stage goal's current_stage from its stages' triggers and links. True if it moved.
+static bool ms_rederive_current_stage(const TemplateData *td, MultiStageGoal *goal) {
+    if (!goal) return false;
+    int previous_stage = goal->current_stage;
+    std::vector<bool> base_satisfied(goal->stage_count, false);
+    for (int j = 0; j < goal->stage_count; j++) {
+        SubGoal *stage = goal->stages[j];
+        if (!stage || stage->type == SUBGOAL_MANUAL) break;
+        base_satisfied[j] = ms_stage_game_met(stage) ||
+                            (stage->linked_goal_count > 0 &&
+                             check_linked_goals_satisfied(td, stage->linked_goals,
+                                                          stage->linked_goal_count, stage->linked_goal_mode));
+    }
+    goal->current_stage = ms_compute_current_stage(goal, base_satisfied);
+    return goal->current_stage != previous_stage;
+}
+
 /**
  * @brief Re-derives every multi-stage goal's current_stage without player files in scope.
  * Used by recalculation paths (e.g. manual custom-goal toggles). Each stage is considered complete when its
  * game trigger is met (stat stages: live from current_stat_progress; other stages: the stored game_trigger_met
  * flag last set by a full update or Hermes event) OR its linked goals are satisfied. Because it fully recomputes
  * the leading run, it both advances and regresses (so unchecking a linked goal can re-open a stage).
- * The final stage is never auto-completed. Returns true if any goal changed (used for fixed-point iteration).
+ * The final stage is never auto-completed. Returns true if any goal changed (tracker_propagate_linked_goals()'
+ * graph-less fallback).
  */
 static bool tracker_update_multi_stage_linked_goals(Tracker *t) {
     if (!t || !t->template_data) return false;
     TemplateData *td = t->template_data;
     bool any_changed = false;
 
+    for (int i = 0; i < td->multi_stage_goal_count; i++) {
+        any_changed |= ms_rederive_current_stage(td, td->multi_stage_goals[i]);
+    }
+    return any_changed;
+}
+
+// --- Linked-goal dependency graph ---
+// Goals that derive their state from linked goals (manual custom goals, stats, counters and multi-stage
+// goals) are nodes. Every value a node reads - a linked target's done flag or stage, plus the node's
+// own state that something else may have changed - is a "watch". A link from a node's output to
+// another node is an edge. The graph is compiled once per template load into strongly connected
+// components in topological order, so one pass settles every chain. Each update only re-evaluates the
+// nodes downstream of a watch whose value actually changed since the previous propagation. Cycles
+// are reported at load and settled by repeated passes over just the cycle, capped like the old loop.
+
+#define LINKED_GOAL_CYCLE_MAX_PASSES 32
+
+enum LinkedGoalNodeKind { LG_NODE_CUSTOM, LG_NODE_STAT, LG_NODE_COUNTER, LG_NODE_MULTI_STAGE };
+
+enum LinkedGoalWatchKind {
+    LG_WATCH_FLAG, // A done flag
+    LG_WATCH_STAGE, // A multi-stage goal's current_stage
+    LG_WATCH_TRIGGER // A stage's own game trigger (ms_stage_game_met)
+};
+
+struct LinkedGoalWatch {
+    LinkedGoalWatchKind kind;
+    const void *target;
+    int writer; // Node whose evaluation writes this value (-1 = set by game data or the user only)
+    int last; // Value seen at the end of the previous propagation (INT_MIN = never seen)
+    std::vector<int> readers; // Nodes to re-evaluate when the value changes
+};
+
+struct LinkedGoalNode {
+    LinkedGoalNodeKind kind;
+    void *goal;
+    const char *root_name;
+    std::vector<int> outputs; // Watches this node writes
+    std::vector<int> link_reads; // Watches this node's linked goals point at
+    std::vector<int> depends_on; // Nodes whose outputs this node links to (may include itself)
+    bool dirty;
+};
+
+struct LinkedGoalGraph {
+    std::vector<LinkedGoalWatch> watches;
+    std::vector<LinkedGoalNode> nodes;
+    std::vector<std::vector<int> > components; // Strongly connected components, in evaluation order
+    std::vector<char> component_cyclic;
+    std::map<std::pair<const void *, int>, int> watch_ids; // Build-time dedupe (target, kind) -> watch
+};
+
+static int linked_goal_watch_value(const LinkedGoalWatch &w) {
+    switch (w.kind) {
+        case LG_WATCH_FLAG: return *(const bool *) w.target ? 1 : 0;
+        case LG_WATCH_STAGE: return ((const MultiStageGoal *) w.target)->current_stage;
+        case LG_WATCH_TRIGGER: return ms_stage_game_met((const SubGoal *) w.target) ? 1 : 0;
+    }
+    return 0;
+}
+
+static int linked_goal_graph_watch(LinkedGoalGraph *g, LinkedGoalWatchKind kind, const void *target) {
+    auto key = std::make_pair(target, (int) kind);
+    auto it = g->watch_ids.find(key);
+    if (it != g->watch_ids.end()) return it->second;
+    LinkedGoalWatch w;
+    w.kind = kind;
+    w.target = target;
+    w.writer = -1;
+    w.last = INT_MIN;
+    g->watches.push_back(w);
+    int id = (int) g->watches.size() - 1;
+    g->watch_ids.emplace(key, id);
+    return id;
+}
+
+static void linked_goal_graph_read(LinkedGoalGraph *g, int node, int watch) {
+    std::vector<int> &readers = g->watches[watch].readers;
+    if (readers.empty() || readers.back() != node) readers.push_back(node);
+}
+
+static void linked_goal_graph_write(LinkedGoalGraph *g, int node, int watch) {
+    g->watches[watch].writer = node;
+    g->nodes[node].outputs.push_back(watch);
+    linked_goal_graph_read(g, node, watch); // Changed from outside (a user toggle) -> re-derive
+}
+
+static void linked_goal_graph_read_links(LinkedGoalGraph *g, int node, const CounterLinkedGoal *goals, int count) {
+    for (int j = 0; goals && j < count; j++) {
+        const CounterLinkedGoal *lg = &goals[j];
+        int watch;
+        if (lg->resolved_msg) {
+            watch = linked_goal_graph_watch(g, LG_WATCH_STAGE, lg->resolved_msg);
+        } else if (lg->resolved_done) {
+            watch = linked_goal_graph_watch(g, LG_WATCH_FLAG, lg->resolved_done);
+        } else {
+            continue; // Unresolved targets never complete, nothing to watch
+        }
+        linked_goal_graph_read(g, node, watch);
+        g->nodes[node].link_reads.push_back(watch);
+    }
+}
+
+static int linked_goal_graph_add_node(LinkedGoalGraph *g, LinkedGoalNodeKind kind, void *goal,
+                                      const char *root_name) {
+    LinkedGoalNode n;
+    n.kind = kind;
+    n.goal = goal;
+    n.root_name = root_name;
+    n.dirty = true;
+    g->nodes.push_back(n);
+    return (int) g->nodes.size() - 1;
+}
+
+// Tarjan's algorithm over the depends_on edges. A component is emitted only after every component it
+// depends on, so the emission order is the evaluation order.
+static void linked_goal_graph_strongconnect(LinkedGoalGraph *g, int v, std::vector<int> &index, std::vector<int> &low,
+                                            std::vector<char> &on_stack, std::vector<int> &stack, int &counter) {
+    index[v] = low[v] = counter++;
+    stack.push_back(v);
+    on_stack[v] = 1;
+    for (int u: g->nodes[v].depends_on) {
+        if (index[u] < 0) {
+            linked_goal_graph_strongconnect(g, u, index, low, on_stack, stack, counter);
+            low[v] = std::min(low[v], low[u]);
+        } else if (on_stack[u]) {
+            low[v] = std::min(low[v], index[u]);
+        }
+    }
+    if (low[v] == index[v]) {
+        std::vector<int> component;
+        int u;
+        do {
+            u = stack.back();
+            stack.pop_back();
+            on_stack[u] = 0;
+            component.push_back(u);
+        } while (u != v);
+        g->components.push_back(component);
+    }
+}
+
+static void linked_goal_graph_free(LinkedGoalGraph *g) {
+    delete g;
+}
+
+/**
+ * @brief Compiles the template's linked goals into a dependency graph. Must run after
+ * tracker_resolve_linked_goals(). Circular links are logged so the template author can fix them.
+ */
+static void tracker_build_linked_goal_graph(TemplateData *td) {
+    if (!td) return;
+    linked_goal_graph_free(td->linked_goal_graph);
+    LinkedGoalGraph *g = new LinkedGoalGraph();
+
+    for (int i = 0; i < td->custom_goal_count; i++) {
+        TrackableItem *cg = td->custom_goals[i];
+        if (!cg || cg->goal > 0 || cg->linked_goal_count <= 0) continue;
+        int n = linked_goal_graph_add_node(g, LG_NODE_CUSTOM, cg, cg->root_name);
+        linked_goal_graph_write(g, n, linked_goal_graph_watch(g, LG_WATCH_FLAG, &cg->done));
+        linked_goal_graph_read_links(g, n, cg->linked_goals, cg->linked_goal_count);
+    }
+    // Every stat is a node: besides its links, "all sub-stats done" completes the category.
+    for (int i = 0; i < td->stat_count; i++) {
+        TrackableCategory *stat_cat = td->stats[i];
+        if (!stat_cat) continue;
+        int n = linked_goal_graph_add_node(g, LG_NODE_STAT, stat_cat, stat_cat->root_name);
+        linked_goal_graph_write(g, n, linked_goal_graph_watch(g, LG_WATCH_FLAG, &stat_cat->done));
+        linked_goal_graph_read_links(g, n, stat_cat->linked_goals, stat_cat->linked_goal_count);
+        for (int j = 0; j < stat_cat->criteria_count; j++) {
+            TrackableItem *sub_stat = stat_cat->criteria[j];
+            if (!sub_stat) continue;
+            linked_goal_graph_write(g, n, linked_goal_graph_watch(g, LG_WATCH_FLAG, &sub_stat->done));
+            linked_goal_graph_read_links(g, n, sub_stat->linked_goals, sub_stat->linked_goal_count);
+        }
+    }
+    for (int i = 0; i < td->counter_goal_count; i++) {
+        CounterGoal *counter = td->counter_goals[i];
+        if (!counter) continue;
+        int n = linked_goal_graph_add_node(g, LG_NODE_COUNTER, counter, counter->root_name);
+        linked_goal_graph_write(g, n, linked_goal_graph_watch(g, LG_WATCH_FLAG, &counter->done));
+        linked_goal_graph_read_links(g, n, counter->linked_goals, counter->linked_goal_count);
+    }
     for (int i = 0; i < td->multi_stage_goal_count; i++) {
         MultiStageGoal *goal = td->multi_stage_goals[i];
         if (!goal) continue;
-        int previous_stage = goal->current_stage;
-        std::vector<bool> base_satisfied(goal->stage_count, false);
+        int n = linked_goal_graph_add_node(g, LG_NODE_MULTI_STAGE, goal, goal->root_name);
+        linked_goal_graph_write(g, n, linked_goal_graph_watch(g, LG_WATCH_STAGE, goal));
         for (int j = 0; j < goal->stage_count; j++) {
             SubGoal *stage = goal->stages[j];
             if (!stage || stage->type == SUBGOAL_MANUAL) break;
-            // Stat stages re-derive live (Hermes/full updates keep current_stat_progress accurate); other
-            // stage types rely on the stored game_trigger_met flag.
-            bool game_met = (stage->type == SUBGOAL_STAT)
-                                ? (stage->required_progress > 0 &&
-                                   stage->current_stat_progress >= stage->required_progress)
-                                : stage->game_trigger_met;
-            base_satisfied[j] = game_met ||
-                                (stage->linked_goal_count > 0 &&
-                                 check_linked_goals_satisfied(td, stage->linked_goals,
-                                                              stage->linked_goal_count, stage->linked_goal_mode));
+            linked_goal_graph_read(g, n, linked_goal_graph_watch(g, LG_WATCH_TRIGGER, stage));
+            linked_goal_graph_read_links(g, n, stage->linked_goals, stage->linked_goal_count);
         }
-        goal->current_stage = ms_compute_current_stage(goal, base_satisfied);
-        if (goal->current_stage != previous_stage) any_changed = true;
     }
-    return any_changed;
+    g->watch_ids.clear();
+
+    // Edges: a node depends on the writer of every value its links read (itself included, e.g. a
+    // sub-stat linked to a sibling). Reads of its own state alone are not edges.
+    for (LinkedGoalNode &n: g->nodes) {
+        for (int w: n.link_reads) {
+            int writer = g->watches[w].writer;
+            if (writer >= 0 && std::find(n.depends_on.begin(), n.depends_on.end(), writer) == n.depends_on.end())
+                n.depends_on.push_back(writer);
+        }
+    }
+
+    int count = (int) g->nodes.size();
+    std::vector<int> index(count, -1), low(count, 0), stack;
+    std::vector<char> on_stack(count, 0);
+    int counter = 0;
+    for (int v = 0; v < count; v++) {
+        if (index[v] < 0) linked_goal_graph_strongconnect(g, v, index, low, on_stack, stack, counter);
+    }
+    g->component_cyclic.assign(g->components.size(), 0);
+    for (size_t c = 0; c < g->components.size(); c++) {
+        const std::vector<int> &component = g->components[c];
+        const std::vector<int> &deps = g->nodes[component[0]].depends_on;
+        bool cyclic = component.size() > 1 ||
+                      std::find(deps.begin(), deps.end(), component[0]) != deps.end();
+        if (!cyclic) continue;
+        g->component_cyclic[c] = 1;
+
+        std::string names;
+        for (int v: component) {
+            if (!names.empty()) names += ", ";
+            names += g->nodes[v].root_name;
+        }
+        log_message(LOG_ERROR,
+                    "[TRACKER] Template has circular linked goals between: %s. They are resolved by up to %d "
+                    "repeated passes; break the cycle in the template to avoid it.\n",
+                    names.c_str(), LINKED_GOAL_CYCLE_MAX_PASSES);
+    }
+
+    td->linked_goal_graph = g;
+}
+
+static bool linked_goal_graph_evaluate(const TemplateData *td, const LinkedGoalNode &n) {
+    switch (n.kind) {
+        case LG_NODE_CUSTOM: return custom_goal_apply_linked_goals(td, (TrackableItem *) n.goal);
+        case LG_NODE_STAT: return stat_apply_linked_goals(td, (TrackableCategory *) n.goal);
+        case LG_NODE_COUNTER: return counter_goal_recount(td, (CounterGoal *) n.goal);
+        case LG_NODE_MULTI_STAGE: return ms_rederive_current_stage(td, (MultiStageGoal *) n.goal);
+    }
+    return false;
+}
+
+// Marks the readers of every output of a node whose value moved since the last propagation.
+static void linked_goal_graph_publish(LinkedGoalGraph *g, const LinkedGoalNode &n) {
+    for (int w: n.outputs) {
+        LinkedGoalWatch &watch = g->watches[w];
+        if (linked_goal_watch_value(watch) == watch.last) continue;
+        for (int reader: watch.readers) g->nodes[reader].dirty = true;
+    }
+}
+
+/**
+ * @brief Brings every linked-goal-derived state up to date after the game data, manual progress or
+ * co-op merge changed it: one pass in dependency order over the goals downstream of a changed value.
+ * Only the dirty frontier is re-evaluated; without a compiled graph it falls back to sweeping every
+ * linked goal until nothing changes.
+ * Multi-stage goals are re-derived from their stored game triggers, so the path's own multi-stage
+ * pass (player files, co-op merge) must have run first.
+ */
+static void tracker_propagate_linked_goals(Tracker *t) {
+    if (!t || !t->template_data) return;
+    TemplateData *td = t->template_data;
+    LinkedGoalGraph *g = td->linked_goal_graph;
+
+    if (!g) {
+        bool changed;
+        int guard = 0;
+        do {
+            changed = tracker_update_custom_goal_linked_goals(t);
+            changed |= tracker_update_stat_linked_goals(t);
+            changed |= tracker_update_counter_goals(t);
+            changed |= tracker_update_multi_stage_linked_goals(t);
+        } while (changed && ++guard < LINKED_GOAL_CYCLE_MAX_PASSES);
+        return;
+    }
+
+    // Seed the frontier with every value that changed since the last propagation.
+    for (LinkedGoalWatch &watch: g->watches) {
+        if (linked_goal_watch_value(watch) == watch.last) continue;
+        for (int reader: watch.readers) g->nodes[reader].dirty = true;
+    }
+
+    int evaluated = 0;
+    for (size_t c = 0; c < g->components.size(); c++) {
+        const std::vector<int> &component = g->components[c];
+        if (!g->component_cyclic[c]) {
+            LinkedGoalNode &n = g->nodes[component[0]];
+            if (!n.dirty) continue;
+            linked_goal_graph_evaluate(td, n);
+            evaluated++;
+            linked_goal_graph_publish(g, n);
+            continue;
+        }
+
+        bool any_dirty = false;
+        for (int v: component) any_dirty |= g->nodes[v].dirty;
+        if (!any_dirty) continue;
+        bool changed;
+        int guard = 0;
+        do {
+            changed = false;
+            for (int v: component) {
+                changed |= linked_goal_graph_evaluate(td, g->nodes[v]);
+                evaluated++;
+            }
+        } while (changed && ++guard < LINKED_GOAL_CYCLE_MAX_PASSES);
+        for (int v: component) linked_goal_graph_publish(g, g->nodes[v]);
+    }
+
+    for (LinkedGoalWatch &watch: g->watches) watch.last = linked_goal_watch_value(watch);
+    for (LinkedGoalNode &n: g->nodes) n.dirty = false;
+    tracker_count_completed_stats(td);
+    profiler_count_n("linked goal evaluations", evaluated);
 }
 
 bool tracker_run_meets_completion(const TemplateData *td, const AppSettings *settings) {
@@ -3834,171 +4851,42 @@ static void tracker_refresh_igt(Tracker *t) {
         td->speedrunigt_ms = t->speedrunigt_stalled ? 0 : igt_ms;
     }
 
-    if (!td->frozen_ticks_pending) return;
-    if (td->play_time_ticks > td->frozen_play_time_ticks) {
-        td->frozen_play_time_ticks = td->play_time_ticks;
-        td->frozen_ticks_pending = false;
-    }
-}
-
-/**
- * @brief Frees an array of TrackableItem pointers.
- *
- * This is used in tracker_free_template_data(). Used for unlocks and custom goals.
- *
- * @param items The array of TrackableItem pointers to be freed.
- * @param count The number of elements in the array.
- */
-static void free_trackable_items(TrackableItem **items, int count) {
-    if (!items) return;
-    for (int i = 0; i < count; i++) {
-        if (items[i]) {
-            // Free linked goals for stat auto-completion
-            if (items[i]->linked_goals) {
-                free(items[i]->linked_goals);
-                items[i]->linked_goals = nullptr;
-            }
-            free(items[i]);
-            items[i] = nullptr;
-        }
-    }
-    free(items);
-    items = nullptr;
-}
-
-/**
- * @brief Frees an array of TrackableCategory pointers. Frees advancements and stats.
- *
- * Used within tracker_free_template_data().
- *
- * @param categories TrackableCategory array
- * @param count Number of categories
- */
-static void free_trackable_categories(TrackableCategory **categories, int count) {
-    if (!categories) return;
-    for (int i = 0; i < count; i++) {
-        if (categories[i]) {
-            // First, free the inner criteria array using the other helper
-            free_trackable_items(categories[i]->criteria, categories[i]->criteria_count);
-
-            // Free linked goals for stat auto-completion
-            if (categories[i]->linked_goals) {
-                free(categories[i]->linked_goals);
-                categories[i]->linked_goals = nullptr;
-            }
-
-            // Then free the category itself
-            free(categories[i]);
-            categories[i] = nullptr;
-        }
-    }
-    free(categories);
-    categories = nullptr;
-}
-
-/**
- * @brief Frees an array of MultiStageGoal pointers, including their nested stages.
- * @param goals The array of MultiStageGoal pointers to be freed.
- * @param count The number of elements in the array.
- */
-static void free_multi_stage_goals(MultiStageGoal **goals, int count) {
-    if (!goals) return;
-    for (int i = 0; i < count; i++) {
-        MultiStageGoal *goal = goals[i];
-        if (goal) {
-            // Free the sub-goals first
-            if (goal->stages) {
-                for (int j = 0; j < goal->stage_count; j++) {
-                    // Check if the pointer is valid before freeing
-                    if (goal->stages[j]) {
-                        // Free linked goals for stage auto-completion
-                        if (goal->stages[j]->linked_goals) {
-                            free(goal->stages[j]->linked_goals);
-                            goal->stages[j]->linked_goals = nullptr;
-                        }
-                        free(goal->stages[j]);
-                        goal->stages[j] = nullptr;
-                    }
-                }
-                free(goal->stages); // Then free the array of pointers
-                goal->stages = nullptr;
-            }
-            free(goal); // Finally, free the parent goal struct
-            goals[i] = nullptr; // Nullify the pointer IN THE ARRAY
-        }
-    }
-    free(goals); // Free the top-level array of goal pointers
-    goals = nullptr;
-}
-
-
-/**
- * @brief Frees all dynamically allocated memory within a TemplateData struct. Multi-stage goals are freed here.
- *
- * To avoid memory leaks when switching templates during runtime.
- * It only frees the CONTENT of the TemplateData NOT the TemplateData itself.
- *
- * @param td A pointer to the TemplateData to be freed.
- */
-static void tracker_free_template_data(TemplateData *td) {
-    if (!td) return;
-
-
-    // Free categories
-    if (td->advancements) {
-        free_trackable_categories(td->advancements, td->advancement_count);
-    }
-
-    if (td->stats) {
-        free_trackable_categories(td->stats, td->stat_count);
-    }
-
-    if (td->unlocks) {
-        free_trackable_items(td->unlocks, td->unlock_count);
-    }
-
-    // Free custom goal data
-    if (td->custom_goals) {
-        free_trackable_items(td->custom_goals, td->custom_goal_count);
-    }
-
-    // Free multi-stage goals data
-    if (td->multi_stage_goals) {
-        free_multi_stage_goals(td->multi_stage_goals, td->multi_stage_goal_count);
-    }
-
-    // Free counter goals data
-    if (td->counter_goals) {
-        for (int i = 0; i < td->counter_goal_count; i++) {
-            if (td->counter_goals[i]) {
-                free(td->counter_goals[i]->linked_goals);
-                free(td->counter_goals[i]);
-            }
-        }
-        free(td->counter_goals);
-    }
-
-    // Free decoration elements
-    if (td->decorations) {
-        for (int i = 0; i < td->decoration_count; i++) {
-            if (td->decorations[i]) {
-                free(td->decorations[i]->linked_goals);
-            }
-            free(td->decorations[i]);
-        }
-        free(td->decorations);
+    if (!td->frozen_ticks_pending) return;
+    if (td->play_time_ticks > td->frozen_play_time_ticks) {
+        td->frozen_play_time_ticks = td->play_time_ticks;
+        td->frozen_ticks_pending = false;
     }
+}
 
-    td->advancements = nullptr;
-    td->stats = nullptr;
-    td->unlocks = nullptr;
-    td->custom_goals = nullptr;
-    td->multi_stage_goals = nullptr;
-    td->counter_goals = nullptr;
-    td->decorations = nullptr;
+/**
+ * @brief Frees all dynamically allocated memory within a TemplateData struct. The parsed goals go with one arena reset.
+ *
+ * To avoid memory leaks when switching templates during runtime.
+ * It only frees the CONTENT of the TemplateData NOT the TemplateData itself.
+ *
+ * @param td A pointer to the TemplateData to be freed.
+ */
+static void tracker_free_template_data(TemplateData *td) {
+    if (!td) return;
 
-    // Zero out the entire struct to reset all pointers and counts safely.
+    // Goals, criteria, stages, decorations and their arrays all live in the arena
+    TemplateArena *arena = td->arena;
+    template_arena_reset(arena);
+
+    linked_goal_graph_free(td->linked_goal_graph);
+    td->linked_goal_graph = nullptr;
+    advancement_match_index_free(td->advancement_match_index);
+    td->advancement_match_index = nullptr;
+    player_file_key_set_free(td->player_file_keys);
+    td->player_file_keys = nullptr;
+    string_pool_free(td->string_pool);
+    td->string_pool = nullptr;
+    hermes_stat_index_free(td->hermes_stat_index);
+    td->hermes_stat_index = nullptr;
+
+    // Zero out the entire struct to reset all pointers and counts safely. The arena is kept for the next load.
     memset(td, 0, sizeof(TemplateData));
+    td->arena = arena;
 }
 
 
@@ -4155,6 +5043,14 @@ AnimatedTexture *get_animated_texture_from_cache(SDL_Renderer *renderer, Animate
     return new_anim;
 }
 
+// One entry of Tracker::hermes_time_index. time_before is the newest stat/advancement time of
+// every line before offset, so it never decreases along the index even if Hermes writes events
+// slightly out of order, and a replay may skip everything before a mark older than its cutoff.
+struct HermesTimeMark {
+    long offset; // Start of a line in play.log.enc
+    long long time_before;
+};
+
 bool tracker_new(Tracker **tracker, AppSettings *settings) {
     // Allocate memory for the tracker itself
     // Calloc assures null initialization
@@ -4171,12 +5067,18 @@ bool tracker_new(Tracker **tracker, AppSettings *settings) {
     new(&t->hermes_rotator) HermesRotator();
     t->hermes_play_log = nullptr;
     t->hermes_file_offset = 0;
+    t->hermes_read_buf = nullptr;
+    t->hermes_read_len = 0;
+    t->hermes_read_cap = 0;
+    t->hermes_time_index = new std::vector<HermesTimeMark>();
+    t->hermes_newest_event_ms = 0;
     t->hermes_active = false;
     t->hermes_world_name[0] = '\0';
     t->hermes_wants_ipc_flush = false;
     t->hermes_coop_stat_cache = new std::unordered_map<std::string, int>();
     t->hermes_adv_file_mtime_ms = 0;
     t->hermes_adv_mtime_by_uuid = new std::unordered_map<std::string, uint64_t>();
+    t->json_file_cache = json_file_cache_new();
 
     // Initialize notes state
     t->notes_window_open = false;
@@ -4453,10 +5355,13 @@ static void coop_merge_advancements_modern(TemplateData *td, const cJSON *player
                                            const char *player_uuid) {
     if (!player_adv_json) return;
 
+    std::vector<const cJSON *> player_entries;
+    advancement_match_entries(td, player_adv_json, player_entries);
+
     for (int i = 0; i < td->advancement_count; i++) {
         TrackableCategory *adv = td->advancements[i];
 
-        cJSON *player_entry = cJSON_GetObjectItem(player_adv_json, adv->root_name);
+        const cJSON *player_entry = player_entries[i];
         if (!player_entry) continue;
 
         bool game_is_done = cJSON_IsTrue(cJSON_GetObjectItem(player_entry, "done"));
@@ -4481,11 +5386,7 @@ static void coop_merge_advancements_modern(TemplateData *td, const cJSON *player
 
             cJSON *player_criteria = cJSON_GetObjectItem(player_entry, "criteria");
             std::vector<char> player_flags(adv->criteria_count, 0);
-            if (player_criteria) {
-                for (int j = 0; j < adv->criteria_count; j++) {
-                    player_flags[j] = cJSON_HasObjectItem(player_criteria, adv->criteria[j]->root_name) ? 1 : 0;
-                }
-            }
+            if (player_criteria) advancement_match_criteria(td, i, player_criteria, player_flags.data());
             // Compare players on group-collapsed counts so grouping is respected in coop "highest" mode.
             int this_player_count = tracker_count_groups_from_flags(
                 adv, player_flags.empty() ? nullptr : player_flags.data());
@@ -4642,7 +5543,7 @@ static void coop_merge_achievements_legacy(TemplateData *td, const cJSON *player
  */
 static void coop_merge_stats_modern(TemplateData *td, const cJSON *player_stats_json,
                                     CoopStatMerge merge_mode, MC_Version version,
-                                    const char *player_uuid) {
+                                    const char *player_uuid, ModernStatsIndex *stats_index) {
     if (!player_stats_json) return;
 
     cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
@@ -4667,27 +5568,22 @@ static void coop_merge_stats_modern(TemplateData *td, const cJSON *player_stats_
         for (int j = 0; j < stat_cat->criteria_count; j++) {
             TrackableItem *sub_stat = stat_cat->criteria[j];
 
-            if (sub_stat->stat_category_key[0] != '\0') {
-                cJSON *category_obj = cJSON_GetObjectItem(stats_obj, sub_stat->stat_category_key);
-                if (category_obj) {
-                    cJSON *stat_value = cJSON_GetObjectItem(category_obj, sub_stat->stat_item_key);
-                    if (cJSON_IsNumber(stat_value)) {
-                        int player_value = stat_value->valueint;
-                        if (merge_mode == COOP_STAT_CUMULATIVE) {
-                            sub_stat->progress += player_value;
-                        } else {
-                            // COOP_STAT_HIGHEST: strict-greater so ties keep the
-                            // current leader (lowest roster index since we iterate
-                            // players in roster order in the caller).
-                            if (player_value > sub_stat->progress) {
-                                sub_stat->progress = player_value;
-                                if (player_uuid && player_uuid[0] != '\0') {
-                                    strncpy(sub_stat->highest_contributor_uuid, player_uuid,
-                                            sizeof(sub_stat->highest_contributor_uuid) - 1);
-                                    sub_stat->highest_contributor_uuid[
-                                        sizeof(sub_stat->highest_contributor_uuid) - 1] = '\0';
-                                }
-                            }
+            int player_value;
+            if (modern_stats_index_find(stats_index, sub_stat->stat_category_key, sub_stat->stat_item_key,
+                                        &player_value)) {
+                if (merge_mode == COOP_STAT_CUMULATIVE) {
+                    sub_stat->progress += player_value;
+                } else {
+                    // COOP_STAT_HIGHEST: strict-greater so ties keep the
+                    // current leader (lowest roster index since we iterate
+                    // players in roster order in the caller).
+                    if (player_value > sub_stat->progress) {
+                        sub_stat->progress = player_value;
+                        if (player_uuid && player_uuid[0] != '\0') {
+                            strncpy(sub_stat->highest_contributor_uuid, player_uuid,
+                                    sizeof(sub_stat->highest_contributor_uuid) - 1);
+                            sub_stat->highest_contributor_uuid[
+                                sizeof(sub_stat->highest_contributor_uuid) - 1] = '\0';
                         }
                     }
                 }
@@ -4863,7 +5759,7 @@ static void coop_finalize_unlocks(TemplateData *td) {
  */
 static void coop_merge_multi_stage(TemplateData *td, const cJSON *player_adv_json,
                                    const cJSON *player_stats_json, const cJSON *player_unlocks_json,
-                                   MC_Version version) {
+                                   MC_Version version, ModernStatsIndex *stats_index) {
     if (td->multi_stage_goal_count == 0) return;
     if (!player_adv_json && !player_stats_json) return;
 
@@ -4905,23 +5801,8 @@ static void coop_merge_multi_stage(TemplateData *td, const cJSON *player_adv_jso
                             player_progress = stat_entry->valueint;
                         }
                     } else {
-                        cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
-                        if (stats_obj) {
-                            char root_copy[192];
-                            strncpy(root_copy, stage->root_name, sizeof(root_copy) - 1);
-                            root_copy[sizeof(root_copy) - 1] = '\0';
-                            char *item_key = strchr(root_copy, '/');
-                            if (item_key) {
-                                *item_key = '\0';
-                                item_key++;
-                                cJSON *cat_obj = cJSON_GetObjectItem(stats_obj, root_copy);
-                                if (cat_obj) {
-                                    cJSON *val = cJSON_GetObjectItem(cat_obj, item_key);
-                                    if (cJSON_IsNumber(val)) {
-                                        player_progress = val->valueint;
-                                    }
-                                }
-                            }
+                        if (strchr(stage->root_name, '/')) {
+                            modern_stats_index_find(stats_index, stage->root_name, &player_progress);
                         }
                     }
 
@@ -5003,8 +5884,8 @@ static bool coop_finalize_multi_stage(TemplateData *td) {
             stage->game_trigger_met = stage_completed;
 
             // Base satisfaction: own trigger OR linked goals. The "complete with next stage" rule is
-            // applied afterwards by ms_compute_current_stage. Chains of linked goals resolve through
-            // the fixed-point iteration in the caller.
+            // applied afterwards by ms_compute_current_stage. Chains of linked goals settle in the
+            // caller's tracker_propagate_linked_goals().
             base_satisfied[j] = stage_completed ||
                                 (stage->linked_goal_count > 0 &&
                                  check_linked_goals_satisfied(td, stage->linked_goals,
@@ -5181,6 +6062,7 @@ static bool world_names_match(const char *a, const char *b) {
 
 // Periodically recheck file changes
 void tracker_update(Tracker *t, const AppSettings *settings) {
+    json_file_cache_begin_pass(t->json_file_cache); // Player file trees stay valid for this update
     // Detect if the world has changed since the last update.
     if (!world_names_match(t->world_name, t->template_data->last_known_world_name)) {
         // Save notes for the OLD world before doing anything else
@@ -5197,6 +6079,9 @@ void tracker_update(Tracker *t, const AppSettings *settings) {
 
         // Invalidate the old UI widget state by changing its future ID
         t->notes_widget_id_counter++;
+
+        // Resync the overlay with a full template instead of a burst of resets as deltas
+        t->ipc_full_publish_pending = true;
     }
     // After the check, update the last known world name to the current one for the next cycle.
     strncpy(t->template_data->last_known_world_name, t->world_name,
@@ -5238,59 +6123,48 @@ void tracker_update(Tracker *t, const AppSettings *settings) {
     // Load all necessary player files ONCE
     cJSON *player_adv_json = nullptr;
     // (strlen(t->advancements_path) > 0) ? cJSON_from_file(t->advancements_path) : nullptr;
-    cJSON *player_stats_json = (strlen(t->stats_path) > 0) ? cJSON_from_file(t->stats_path) : nullptr;
-    cJSON *player_unlocks_json = (strlen(t->unlocks_path) > 0) ? cJSON_from_file(t->unlocks_path) : nullptr;
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
+    // Unchanged files come straight from the fingerprint cache (owned by it, so not deleted below),
+    // and custom goal progress and stat overrides from the resident progress store
+    cJSON *player_stats_json = tracker_player_stats_json(t, t->stats_path, version);
+    cJSON *player_unlocks_json = tracker_cached_json(t, t->unlocks_path);
+    cJSON *settings_json = settings_progress_store_get();
+
+    // Modern stats are resolved through an index of the file, built once per read
+    ModernStatsIndex stats_index;
+    if (version >= MC_VERSION_1_13) modern_stats_index_build(&stats_index, player_stats_json);
 
     // Version-based Dispatch
     const char *self_uuid = settings->local_player.uuid;
     if (version <= MC_VERSION_1_6_4) {
         // If StatsPerWorld mod is enabled, stats file is per-world, still using IDs
-        tracker_update_stats_legacy(t, player_stats_json, self_uuid, legacy_baseline);
+        tracker_update_stats_legacy(t, player_stats_json, settings_json, self_uuid, legacy_baseline);
     } else if (version >= MC_VERSION_1_7_2 && version <= MC_VERSION_1_11_2) {
         // Mid-Era: 1.7.2 through 1.11.2
         // This function handles both achievements and stats for this range.
-        tracker_update_achievements_and_stats_mid(t, player_stats_json, self_uuid);
+        tracker_update_achievements_and_stats_mid(t, player_stats_json, settings_json, self_uuid);
     } else if (version >= MC_VERSION_1_12 && version <= MC_VERSION_1_12_2) {
         // Hybrid Era: 1.12.x (Modern Advancements, Mid-era Stats)
-        player_adv_json = (strlen(t->advancements_path) > 0) ? cJSON_from_file(t->advancements_path) : nullptr;
+        player_adv_json = tracker_player_adv_json(t, t->advancements_path);
         tracker_update_advancements_modern(t, player_adv_json);
         tracker_update_stats_mid(t, player_stats_json, settings_json, self_uuid); // Use the new stats-only function
     } else if (version >= MC_VERSION_1_13) {
         // Modern Era: 1.13+
-        player_adv_json = (strlen(t->advancements_path) > 0) ? cJSON_from_file(t->advancements_path) : nullptr;
+        player_adv_json = tracker_player_adv_json(t, t->advancements_path);
         tracker_update_advancements_modern(t, player_adv_json);
 
         // Needs version for playtime as 1.17 renames minecraft:play_one_minute into minecraft:play_time
-        tracker_update_stats_modern(t, player_stats_json, settings_json, version, self_uuid);
+        tracker_update_stats_modern(t, player_stats_json, settings_json, version, self_uuid, &stats_index);
         tracker_update_unlock_progress(t, player_unlocks_json); // Just returns if unlocks don't exist
     }
 
     // Pass the parsed data to the update functions
     tracker_update_custom_progress(t, settings_json, settings, settings->local_player.uuid);
-    tracker_update_multi_stage_progress(t, player_adv_json, player_stats_json, player_unlocks_json, version, settings);
-    // Fixed-point iteration: run until no new completions occur (handles arbitrary-depth chains).
-    // Counters participate so that stats/custom goals/counters can all link to counters.
-    // Safety cap of 32 iterations prevents infinite loops from unexpected circular references.
-    {
-        bool changed;
-        int guard = 0;
-        do {
-            changed = tracker_update_custom_goal_linked_goals(t);
-            changed |= tracker_update_stat_linked_goals(t);
-            changed |= tracker_update_counter_goals(t);
-            changed |= tracker_update_multi_stage_progress(t, player_adv_json, player_stats_json,
-                                                           player_unlocks_json, version, settings);
-        } while (changed && ++guard < 32);
-    }
+    tracker_update_multi_stage_progress(t, player_adv_json, player_stats_json, player_unlocks_json, version, settings,
+                                        &stats_index);
+    // Settle linked goals (custom goals, stats, counters, multi-stage stages) in dependency order
+    tracker_propagate_linked_goals(t);
     tracker_calculate_overall_progress(t, version, settings); //THIS TRACKS SUB-ADVANCEMENTS AND EVERYTHING ELSE
     tracker_refresh_igt(t);
-
-    // Clean up the parsed JSON objects
-    cJSON_Delete(player_adv_json);
-    cJSON_Delete(player_stats_json);
-    cJSON_Delete(player_unlocks_json);
-    cJSON_Delete(settings_json);
 }
 
 // Merge one player's on-disk save files (by UUID) into the group template.
@@ -5330,15 +6204,16 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
     }
 
     // Parse the player's JSON files
-    cJSON *player_adv_json = (player_adv_path[0] != '\0') ? cJSON_from_file(player_adv_path) : nullptr;
-    cJSON *player_stats_json = (player_stats_path[0] != '\0') ? cJSON_from_file(player_stats_path) : nullptr;
-    cJSON *player_unlocks_json = (player_unlocks_path[0] != '\0') ? cJSON_from_file(player_unlocks_path) : nullptr;
+    cJSON *player_adv_json = tracker_player_adv_json(t, player_adv_path);
+    cJSON *player_stats_json = tracker_player_stats_json(t, player_stats_path, version);
+    cJSON *player_unlocks_json = tracker_cached_json(t, player_unlocks_path);
 
     // LEGACY (<=1.6.4) ONLY: for non-host players, override the stats JSON with
     // whatever the receiver uploaded over the wire. Legacy stats live outside
     // the world folder (per-launcher), so the on-disk file here belongs to the
     // host and can't represent any receiver's progress.
     void *uploaded_bytes = nullptr;
+    cJSON *uploaded_stats_json = nullptr;
     if (version <= MC_VERSION_1_6_4 && g_coop_ctx &&
         strcmp(uuid, settings->local_player.uuid) != 0) {
         uint32_t uploaded_size = 0;
@@ -5348,12 +6223,15 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
             cJSON *parsed = cJSON_ParseWithLength((const char *) uploaded_bytes,
                                                   (size_t) uploaded_size);
             if (parsed) {
-                cJSON_Delete(player_stats_json);
+                uploaded_stats_json = parsed; // The cached disk copy stays with the file cache
                 player_stats_json = parsed;
             }
         }
     }
 
+    ModernStatsIndex stats_index;
+    if (version >= MC_VERSION_1_13) modern_stats_index_build(&stats_index, player_stats_json);
+
     // Merge advancements/achievements
     if (version <= MC_VERSION_1_6_4) {
         coop_merge_achievements_legacy(t->template_data, player_stats_json, nullptr, uuid);
@@ -5366,7 +6244,8 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
         coop_merge_stats_mid(t->template_data, player_stats_json, settings->coop_stat_merge, uuid);
     } else if (version >= MC_VERSION_1_13) {
         coop_merge_advancements_modern(t->template_data, player_adv_json, uuid);
-        coop_merge_stats_modern(t->template_data, player_stats_json, settings->coop_stat_merge, version, uuid);
+        coop_merge_stats_modern(t->template_data, player_stats_json, settings->coop_stat_merge, version, uuid,
+                                &stats_index);
     }
 
     // CRAFTMINE ONLY: combined view AND-merges into the group result; an
@@ -5381,7 +6260,7 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
 
     // Merge multi-stage goals (global — any player any stage)
     coop_merge_multi_stage(t->template_data, player_adv_json, player_stats_json,
-                           player_unlocks_json, version);
+                           player_unlocks_json, version, &stats_index);
 
     // Seed the Hermes per-player stat cache with this player's current values.
     // This prevents double-counting when the first Hermes event arrives after
@@ -5395,33 +6274,28 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
 
         if (version >= MC_VERSION_1_13) {
             // Modern: stats → { "minecraft:custom": { "minecraft:play_time": 123, ... }, ... }
-            cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
-            if (stats_obj) {
-                for (int i = 0; i < t->template_data->stat_count; i++) {
-                    TrackableCategory *sc = t->template_data->stats[i];
-                    for (int j = 0; j < sc->criteria_count; j++) {
-                        TrackableItem *sub = sc->criteria[j];
-                        if (sub->stat_category_key[0] == '\0') continue;
-                        cJSON *cat_obj = cJSON_GetObjectItem(stats_obj, sub->stat_category_key);
-                        if (!cat_obj) continue;
-                        cJSON *val = cJSON_GetObjectItem(cat_obj, sub->stat_item_key);
-                        if (cJSON_IsNumber(val)) {
-                            // Build the Hermes-format key: "minecraft.picked_up:minecraft.oak_log"
-                            // Hermes uses dots where the JSON has colons in the category/item prefix
-                            char hermes_key[384];
-                            char h_cat[192], h_item[192];
-                            strncpy(h_cat, sub->stat_category_key, sizeof(h_cat) - 1);
-                            h_cat[sizeof(h_cat) - 1] = '\0';
-                            strncpy(h_item, sub->stat_item_key, sizeof(h_item) - 1);
-                            h_item[sizeof(h_item) - 1] = '\0';
-                            // Convert "minecraft:picked_up" → "minecraft.picked_up"
-                            char *colon_pos = strchr(h_cat, ':');
-                            if (colon_pos) *colon_pos = '.';
-                            colon_pos = strchr(h_item, ':');
-                            if (colon_pos) *colon_pos = '.';
-                            snprintf(hermes_key, sizeof(hermes_key), "%s:%s", h_cat, h_item);
-                            (*hermes_cache)[uuid_prefix + hermes_key] = val->valueint;
-                        }
+            for (int i = 0; i < t->template_data->stat_count; i++) {
+                TrackableCategory *sc = t->template_data->stats[i];
+                for (int j = 0; j < sc->criteria_count; j++) {
+                    TrackableItem *sub = sc->criteria[j];
+                    int value;
+                    if (modern_stats_index_find(&stats_index, sub->stat_category_key, sub->stat_item_key,
+                                                &value)) {
+                        // Build the Hermes-format key: "minecraft.picked_up:minecraft.oak_log"
+                        // Hermes uses dots where the JSON has colons in the category/item prefix
+                        char hermes_key[384];
+                        char h_cat[192], h_item[192];
+                        strncpy(h_cat, sub->stat_category_key, sizeof(h_cat) - 1);
+                        h_cat[sizeof(h_cat) - 1] = '\0';
+                        strncpy(h_item, sub->stat_item_key, sizeof(h_item) - 1);
+                        h_item[sizeof(h_item) - 1] = '\0';
+                        // Convert "minecraft:picked_up" → "minecraft.picked_up"
+                        char *colon_pos = strchr(h_cat, ':');
+                        if (colon_pos) *colon_pos = '.';
+                        colon_pos = strchr(h_item, ':');
+                        if (colon_pos) *colon_pos = '.';
+                        snprintf(hermes_key, sizeof(hermes_key), "%s:%s", h_cat, h_item);
+                        (*hermes_cache)[uuid_prefix + hermes_key] = value;
                     }
                 }
             }
@@ -5467,13 +6341,7 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
                     strncpy(item_json, slash + 1, sizeof(item_json) - 1);
                     item_json[sizeof(item_json) - 1] = '\0';
 
-                    cJSON *stats_obj = cJSON_GetObjectItem(player_stats_json, "stats");
-                    if (!stats_obj) continue;
-                    cJSON *cat_obj = cJSON_GetObjectItem(stats_obj, cat_json);
-                    if (!cat_obj) continue;
-                    cJSON *val = cJSON_GetObjectItem(cat_obj, item_json);
-                    if (!cJSON_IsNumber(val)) continue;
-                    player_value = val->valueint;
+                    if (!modern_stats_index_find(&stats_index, stage->root_name, &player_value)) continue;
 
                     // Rebuild the Hermes-format key: colons in cat/item become dots.
                     char *colon_pos = strchr(cat_json, ':');
@@ -5497,9 +6365,7 @@ static void coop_merge_one_player_from_disk(Tracker *t, const AppSettings *setti
     }
 
     // Clean up this player's JSON
-    cJSON_Delete(player_adv_json);
-    cJSON_Delete(player_stats_json);
-    cJSON_Delete(player_unlocks_json);
+    cJSON_Delete(uploaded_stats_json); // The file JSONs belong to the file cache
     free(uploaded_bytes); // LEGACY cache copy; no-op if not used.
 }
 
@@ -5692,6 +6558,7 @@ void tracker_refresh_ghost_players(Tracker *t, const AppSettings *settings, MC_V
 
 void tracker_update_coop_merged(Tracker *t, const AppSettings *settings) {
     if (!t || !t->template_data || !settings) return;
+    json_file_cache_begin_pass(t->json_file_cache); // Player file trees stay valid for this update
 
     MC_Version version = settings_get_version_from_string(settings->version_str);
 
@@ -5789,7 +6656,7 @@ void tracker_update_coop_merged(Tracker *t, const AppSettings *settings) {
     }
 
     // 3. Finalize after all players are merged
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
+    cJSON *settings_json = settings_progress_store_get();
 
     coop_finalize_advancements(t->template_data);
     // All-Players view: ANY_PLAYER => OR across all UUIDs; HOST_ONLY => host subtree only.
@@ -5805,17 +6672,8 @@ void tracker_update_coop_merged(Tracker *t, const AppSettings *settings) {
                                   : settings->local_player.uuid;
     tracker_update_custom_progress(t, settings_json, settings, custom_uuid);
 
-    // Fixed-point iteration for linked goals
-    {
-        bool changed;
-        int guard = 0;
-        do {
-            changed = tracker_update_custom_goal_linked_goals(t);
-            changed |= tracker_update_stat_linked_goals(t);
-            changed |= tracker_update_counter_goals(t);
-            changed |= coop_finalize_multi_stage(t->template_data);
-        } while (changed && ++guard < 32);
-    }
+    // Settle linked goals in dependency order
+    tracker_propagate_linked_goals(t);
 
     // Preserve prior completion latch for the All-Players view so the frozen
     // timer doesn't re-freeze to the latest play time on every merge cycle.
@@ -5829,13 +6687,12 @@ void tracker_update_coop_merged(Tracker *t, const AppSettings *settings) {
     t->coop_latched_run_completed[0] = t->template_data->run_completed;
     t->coop_latched_frozen_ticks[0] = t->template_data->frozen_play_time_ticks;
     t->coop_latched_frozen_pending[0] = t->template_data->frozen_ticks_pending;
-
-    cJSON_Delete(settings_json);
 }
 
 void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings, int player_idx) {
     if (!t || !t->template_data || !settings) return;
     if (player_idx < 0 || player_idx >= settings->coop_player_count) return;
+    json_file_cache_begin_pass(t->json_file_cache); // Player file trees stay valid for this update
 
     MC_Version version = settings_get_version_from_string(settings->version_str);
 
@@ -5855,13 +6712,14 @@ void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings,
         player_adv_path, player_stats_path, player_unlocks_path, MAX_PATH_LENGTH
     );
 
-    cJSON *player_adv_json = (player_adv_path[0] != '\0') ? cJSON_from_file(player_adv_path) : nullptr;
-    cJSON *player_stats_json = (player_stats_path[0] != '\0') ? cJSON_from_file(player_stats_path) : nullptr;
-    cJSON *player_unlocks_json = (player_unlocks_path[0] != '\0') ? cJSON_from_file(player_unlocks_path) : nullptr;
+    cJSON *player_adv_json = tracker_player_adv_json(t, player_adv_path);
+    cJSON *player_stats_json = tracker_player_stats_json(t, player_stats_path, version);
+    cJSON *player_unlocks_json = tracker_cached_json(t, player_unlocks_path);
 
     // LEGACY (<=1.6.4) ONLY: for non-host players, override the stats JSON with
     // whatever the receiver uploaded over the wire (see tracker_update_coop_merged).
     void *uploaded_bytes = nullptr;
+    cJSON *uploaded_stats_json = nullptr;
     if (version <= MC_VERSION_1_6_4 && g_coop_ctx &&
         strcmp(player->uuid, settings->local_player.uuid) != 0) {
         uint32_t uploaded_size = 0;
@@ -5871,12 +6729,15 @@ void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings,
             cJSON *parsed = cJSON_ParseWithLength((const char *) uploaded_bytes,
                                                   (size_t) uploaded_size);
             if (parsed) {
-                cJSON_Delete(player_stats_json);
+                uploaded_stats_json = parsed; // The cached disk copy stays with the file cache
                 player_stats_json = parsed;
             }
         }
     }
 
+    ModernStatsIndex stats_index;
+    if (version >= MC_VERSION_1_13) modern_stats_index_build(&stats_index, player_stats_json);
+
     if (version <= MC_VERSION_1_6_4) {
         coop_merge_achievements_legacy(t->template_data, player_stats_json, nullptr, player->uuid);
         coop_merge_stats_legacy(t->template_data, player_stats_json, settings->coop_stat_merge, nullptr, player->uuid);
@@ -5888,7 +6749,8 @@ void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings,
         coop_merge_stats_mid(t->template_data, player_stats_json, settings->coop_stat_merge, player->uuid);
     } else if (version >= MC_VERSION_1_13) {
         coop_merge_advancements_modern(t->template_data, player_adv_json, player->uuid);
-        coop_merge_stats_modern(t->template_data, player_stats_json, settings->coop_stat_merge, version, player->uuid);
+        coop_merge_stats_modern(t->template_data, player_stats_json, settings->coop_stat_merge, version, player->uuid,
+                                &stats_index);
     }
 
     // CRAFTMINE ONLY: single-player view mirrors that player's unlocks as-is.
@@ -5898,30 +6760,20 @@ void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings,
     }
 
     coop_merge_multi_stage(t->template_data, player_adv_json, player_stats_json,
-                           player_unlocks_json, version);
+                           player_unlocks_json, version, &stats_index);
 
-    cJSON_Delete(player_adv_json);
-    cJSON_Delete(player_stats_json);
-    cJSON_Delete(player_unlocks_json);
+    cJSON_Delete(uploaded_stats_json); // The file JSONs belong to the file cache
     free(uploaded_bytes); // LEGACY cache copy; no-op if not used.
 
     // Finalize
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
+    cJSON *settings_json = settings_progress_store_get();
 
     coop_finalize_advancements(t->template_data);
     coop_finalize_stats(t->template_data, settings_json, player->uuid);
     coop_finalize_multi_stage(t->template_data);
 
-    tracker_update_custom_progress(t, settings_json, settings, player->uuid); {
-        bool changed;
-        int guard = 0;
-        do {
-            changed = tracker_update_custom_goal_linked_goals(t);
-            changed |= tracker_update_stat_linked_goals(t);
-            changed |= tracker_update_counter_goals(t);
-            changed |= coop_finalize_multi_stage(t->template_data);
-        } while (changed && ++guard < 32);
-    }
+    tracker_update_custom_progress(t, settings_json, settings, player->uuid);
+    tracker_propagate_linked_goals(t);
 
     // Preserve prior completion latch for this per-player view so the frozen
     // timer doesn't re-freeze to the latest play time on every merge cycle.
@@ -5940,13 +6792,12 @@ void tracker_update_coop_single_player(Tracker *t, const AppSettings *settings,
         t->coop_latched_frozen_ticks[slot] = t->template_data->frozen_play_time_ticks;
         t->coop_latched_frozen_pending[slot] = t->template_data->frozen_ticks_pending;
     }
-
-    cJSON_Delete(settings_json);
 }
 
 void tracker_update_coop_single_player_by_uuid(Tracker *t, const AppSettings *settings,
                                                const char *uuid, const char *username) {
     if (!t || !t->template_data || !settings || !uuid || uuid[0] == '\0') return;
+    json_file_cache_begin_pass(t->json_file_cache); // Player file trees stay valid for this update
 
     MC_Version version = settings_get_version_from_string(settings->version_str);
 
@@ -5957,26 +6808,17 @@ void tracker_update_coop_single_player_by_uuid(Tracker *t, const AppSettings *se
     // All-Players merged view's per-UUID deltas.
     coop_merge_one_player_from_disk(t, settings, version, uuid, username ? username : "", nullptr, true);
 
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
+    cJSON *settings_json = settings_progress_store_get();
     coop_finalize_advancements(t->template_data);
     coop_finalize_stats(t->template_data, settings_json, uuid);
     coop_finalize_multi_stage(t->template_data);
     if (version == MC_VERSION_25W14CRAFTMINE) coop_finalize_unlocks(t->template_data);
 
-    tracker_update_custom_progress(t, settings_json, settings, uuid); {
-        bool changed;
-        int guard = 0;
-        do {
-            changed = tracker_update_custom_goal_linked_goals(t);
-            changed |= tracker_update_stat_linked_goals(t);
-            changed |= tracker_update_counter_goals(t);
-            changed |= coop_finalize_multi_stage(t->template_data);
-        } while (changed && ++guard < 32);
-    }
+    tracker_update_custom_progress(t, settings_json, settings, uuid);
+    tracker_propagate_linked_goals(t);
 
     tracker_calculate_overall_progress(t, version, settings);
     tracker_refresh_igt(t);
-    cJSON_Delete(settings_json);
 }
 
 void tracker_stamp_solo_coop_contributor(Tracker *t, const char *uuid) {
@@ -6039,6 +6881,12 @@ void tracker_apply_coop_mods(Tracker *t, const AppSettings *settings,
     // progress and writing that back under source_uuid would corrupt per-player state.
     // The caller forces a full update after this call, which re-reads settings.json
     // and rebuilds merged + per-player snapshots correctly.
+    // Fold journaled changes in first: they predate these mods, so replaying them afterwards would undo any the
+    // mods touch. If they can't be folded, writing now would leave them to do just that.
+    if (!settings_progress_journal_fold()) {
+        log_message(LOG_ERROR, "[TRACKER] Failed to fold progress journal, dropping %d coop mod(s).\n", mod_count);
+        return;
+    }
     cJSON *root = cJSON_from_file(get_settings_file_path());
     if (!root) root = cJSON_CreateObject();
     if (!root) return;
@@ -6139,7 +6987,9 @@ void tracker_apply_coop_mods(Tracker *t, const AppSettings *settings,
     }
 
     SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-    if (!cJSON_write_to_file_atomic(get_settings_file_path(), root)) {
+    if (cJSON_write_to_file_atomic(get_settings_file_path(), root)) {
+        settings_progress_store_commit(root);
+    } else {
         log_message(LOG_ERROR, "[TRACKER] Failed to write settings file for coop mod write.\n");
     }
     cJSON_Delete(root);
@@ -6269,14 +7119,20 @@ void tracker_apply_mod_to_view(Tracker *t, const CoopCustomGoalModMsg *mod) {
     if (!t || !t->template_data || !mod) return;
     TemplateData *td = t->template_data;
 
+    // A name the template doesn't contain interns to no goal, so there is nothing to apply
+    uint32_t goal_sid = string_pool_find(td->string_pool, mod->goal_root_name);
+    if (goal_sid == 0) return;
+
     if (mod->parent_root_name[0] != '\0') {
+        uint32_t parent_sid = string_pool_find(td->string_pool, mod->parent_root_name);
+        if (parent_sid == 0) return;
         // Stat criterion
         for (int i = 0; i < td->stat_count; i++) {
             TrackableCategory *cat = td->stats[i];
-            if (!cat || strcmp(cat->root_name, mod->parent_root_name) != 0) continue;
+            if (!cat || cat->root_sid != parent_sid) continue;
             for (int j = 0; j < cat->criteria_count; j++) {
                 TrackableItem *crit = cat->criteria[j];
-                if (!crit || strcmp(crit->root_name, mod->goal_root_name) != 0) continue;
+                if (!crit || crit->root_sid != goal_sid) continue;
                 if (mod->action == COOP_MOD_TOGGLE) {
                     crit->is_manually_completed = !crit->is_manually_completed;
                     bool nat = (crit->goal > 0 && crit->progress >= crit->goal);
@@ -6299,7 +7155,7 @@ void tracker_apply_mod_to_view(Tracker *t, const CoopCustomGoalModMsg *mod) {
     // No parent: custom goal first, then top-level stat checkbox.
     for (int i = 0; i < td->custom_goal_count; i++) {
         TrackableItem *it = td->custom_goals[i];
-        if (!it || strcmp(it->root_name, mod->goal_root_name) != 0) continue;
+        if (!it || it->root_sid != goal_sid) continue;
         switch (mod->action) {
             case COOP_MOD_TOGGLE:
                 it->is_manually_completed = !it->is_manually_completed;
@@ -6326,7 +7182,7 @@ void tracker_apply_mod_to_view(Tracker *t, const CoopCustomGoalModMsg *mod) {
 
     for (int i = 0; i < td->stat_count; i++) {
         TrackableCategory *cat = td->stats[i];
-        if (!cat || strcmp(cat->root_name, mod->goal_root_name) != 0) continue;
+        if (!cat || cat->root_sid != goal_sid) continue;
         if (mod->action == COOP_MOD_TOGGLE) {
             cat->is_manually_completed = !cat->is_manually_completed;
             for (int j = 0; j < cat->criteria_count; j++) {
@@ -8543,8 +9399,17 @@ static void render_trackable_category_section(Tracker *t, const AppSettings *set
                                         criteria_count);
                                     cat->done = cat->is_manually_completed || all_children_done;
 
-                                    SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-                                    settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                                    // Only multi-criterion stats keep per-sub-stat override keys
+                                    char sub_stat_key[512];
+                                    snprintf(sub_stat_key, sizeof(sub_stat_key), "%s.criteria.%s",
+                                             cat->root_name, crit->root_name);
+                                    if (cat->criteria_count <= 1 ||
+                                        !settings_progress_journal_stat_override(
+                                            settings->local_player.uuid, sub_stat_key,
+                                            crit->is_manually_completed)) {
+                                        SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
+                                        settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                                    }
                                     SDL_SetAtomicInt(&g_coop_broadcast_needed, 1);
                                     SDL_SetAtomicInt(&g_game_data_changed, 1);
                                 }
@@ -9059,8 +9924,12 @@ static void render_trackable_category_section(Tracker *t, const AppSettings *set
                                 cat->criteria_count > 0 && cat->completed_criteria_count >= cat->criteria_count);
                             cat->done = cat->is_manually_completed || all_children_done;
 
-                            SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-                            settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                            // The mirrored single criterion shares the parent's key, so one record covers both
+                            if (!settings_progress_journal_stat_override(settings->local_player.uuid, cat->root_name,
+                                                                         cat->is_manually_completed)) {
+                                SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
+                                settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                            }
                             SDL_SetAtomicInt(&g_coop_broadcast_needed, 1);
                             SDL_SetAtomicInt(&g_game_data_changed, 1);
                         }
@@ -10154,8 +11023,10 @@ static void render_custom_goals_section(Tracker *t, const AppSettings *settings,
                         if (item->goal != -1) {
                             item->progress = item->done ? 1 : 0;
                         }
-                        SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
-                        settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                        if (!settings_progress_journal_custom_goal(settings->local_player.uuid, item)) {
+                            SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
+                            settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
+                        }
                         SDL_SetAtomicInt(&g_coop_broadcast_needed, 1);
                         SDL_SetAtomicInt(&g_game_data_changed, 1);
                     }
@@ -13144,16 +14015,26 @@ void tracker_reinit_template(Tracker *t, AppSettings *settings) {
     settings_prune_compact_stack_items(settings, t->template_data);
 }
 
+// Closes the play.log.enc handle and drops the read position together with any partial line
+// buffered past it and the time index over the read part. The read buffer itself is kept for
+// the next world.
+static void hermes_close_play_log(Tracker *t) {
+    if (t->hermes_play_log) {
+        fclose(t->hermes_play_log);
+        t->hermes_play_log = nullptr;
+    }
+    t->hermes_file_offset = 0;
+    t->hermes_read_len = 0;
+    if (t->hermes_time_index) static_cast<std::vector<HermesTimeMark> *>(t->hermes_time_index)->clear();
+    t->hermes_newest_event_ms = 0;
+}
+
 void tracker_refresh_hermes_log(Tracker *t, const AppSettings *settings) {
     if (!t || !settings) return;
 
     // When Hermes is disabled, drop any open handle and reset state.
     if (!settings->using_hermes) {
-        if (t->hermes_play_log) {
-            fclose(t->hermes_play_log);
-            t->hermes_play_log = nullptr;
-        }
-        t->hermes_file_offset = 0;
+        hermes_close_play_log(t);
         t->hermes_active = false;
         t->hermes_world_name[0] = '\0';
         return;
@@ -13170,11 +14051,7 @@ void tracker_refresh_hermes_log(Tracker *t, const AppSettings *settings) {
     }
 
     // World changed (or no handle yet): close the stale handle and re-detect.
-    if (t->hermes_play_log) {
-        fclose(t->hermes_play_log);
-        t->hermes_play_log = nullptr;
-    }
-    t->hermes_file_offset = 0;
+    hermes_close_play_log(t);
     t->hermes_active = false;
 
     char hermes_log_path[MAX_PATH_LENGTH];
@@ -13183,6 +14060,9 @@ void tracker_refresh_hermes_log(Tracker *t, const AppSettings *settings) {
              t->saves_path, t->world_name);
     FILE *f = fopen(hermes_log_path, "rb");
     if (f) {
+        // Unbuffered: the poll reads straight into hermes_read_buf, so each fread is one read()
+        // instead of a copy through the stdio buffer.
+        setvbuf(f, nullptr, _IONBF, 0);
         t->hermes_play_log = f;
         t->hermes_file_offset = 0; // start from beginning on new world, then it appends
         t->hermes_active = true;
@@ -13313,14 +14193,47 @@ static bool hermes_parse_stat_key(const char *hermes_key,
     return true;
 }
 
+// The sub-stats and multi-stage stages a Hermes stat key feeds, nullptr if the template doesn't track it.
+// Modern keys are looked up in the form hermes_parse_stat_key gives, anything else verbatim.
+static const HermesStatSlots *hermes_find_stat_slots(TemplateData *td, const char *hermes_key) {
+    if (!td->hermes_stat_index) tracker_build_hermes_stat_index(td);
+    HermesStatIndex *index = td->hermes_stat_index;
+
+    char h_cat[192], h_item[192];
+    const std::unordered_map<std::string, HermesStatSlots> *slots = &index->legacy;
+    if (hermes_parse_stat_key(hermes_key, h_cat, h_item, sizeof(h_cat))) {
+        hermes_stat_modern_key(index->probe, h_cat, strlen(h_cat), h_item);
+        slots = &index->modern;
+    } else {
+        index->probe.assign(hermes_key);
+    }
+    auto it = slots->find(index->probe);
+    return it != slots->end() ? &it->second : nullptr;
+}
+
+// Recounts a stat category's completed sub-stats after Hermes changed some of them.
+static void hermes_refresh_stat_category(TrackableCategory *stat_cat) {
+    int completed = 0;
+    for (int j = 0; j < stat_cat->criteria_count; j++) {
+        if (stat_cat->criteria[j] && stat_cat->criteria[j]->done)
+            completed++;
+    }
+    stat_cat->completed_criteria_count = completed;
+
+    if (!stat_cat->is_manually_completed) {
+        stat_cat->done = (stat_cat->criteria_count > 0 &&
+                          completed >= stat_cat->criteria_count);
+    }
+}
+
 
 /**
  * Applies a single Hermes "stat" event to in-memory template data.
  *
- * Key format detection:
+ * Key format detection (resolved through TemplateData::hermes_stat_index):
  *   Modern  (≥1.13): has ':', parsed into category/item, matched via
  *                    stat_category_key / stat_item_key on TrackableItem.
- *   Mid-era / Legacy: no ':', matched by direct strcmp against root_name.
+ *   Mid-era / Legacy: no ':', matched verbatim against root_name.
  *
  * After updating criteria, recalculates category-level completion counters.
  * Also updates the active SUBGOAL_STAT stage in any multi-stage goal.
@@ -13338,106 +14251,53 @@ static bool hermes_apply_stat_event(Tracker *t, const cJSON *data, bool skip_mul
     const char *hermes_key = stat_key_json->valuestring;
     int new_value = (int) value_json->valuedouble;
 
-    char h_cat[192], h_item[192];
-    bool is_modern = hermes_parse_stat_key(hermes_key, h_cat, h_item, sizeof(h_cat));
+    const HermesStatSlots *slots = hermes_find_stat_slots(t->template_data, hermes_key);
+    if (!slots) return false;
 
     bool changed = false;
 
     // --- Stat categories / criteria ---
-    for (int i = 0; i < t->template_data->stat_count; i++) {
-        TrackableCategory *stat_cat = t->template_data->stats[i];
-        if (!stat_cat) continue;
-
-        bool cat_changed = false;
-
-        for (int j = 0; j < stat_cat->criteria_count; j++) {
-            TrackableItem *sub = stat_cat->criteria[j];
-            if (!sub) continue;
-
-            bool matches = false;
-            if (is_modern) {
-                if (sub->stat_category_key[0] == '\0') continue;
-                matches = (strcmp(sub->stat_category_key, h_cat) == 0 &&
-                           strcmp(sub->stat_item_key, h_item) == 0);
-            } else {
-                // Legacy: "5242881", mid-era: "stat.pickup.minecraft.gold_block"
-                // Both stored verbatim in root_name.
-                matches = (strcmp(sub->root_name, hermes_key) == 0);
-            }
-
-            if (!matches) continue;
-
-            // Hermes value is always the cumulative total for one player.
-            // In singleplayer: overwrite directly (only one player).
-            // In coop HIGHEST mode: only apply if higher (preserves max across players).
-            if (new_value <= sub->progress) continue;
-            sub->progress = new_value;
-            if (player_uuid && player_uuid[0] != '\0') {
-                strncpy(sub->highest_contributor_uuid, player_uuid,
-                        sizeof(sub->highest_contributor_uuid) - 1);
-                sub->highest_contributor_uuid[sizeof(sub->highest_contributor_uuid) - 1] = '\0';
-            }
-
-            if (!sub->is_manually_completed) {
-                if (sub->goal > 0) sub->done = (sub->progress >= sub->goal);
-                else if (sub->goal == -1) sub->done = false; // infinite counter
-            }
+    TrackableCategory *changed_cat = nullptr;
+    for (const HermesStatSlots::SubStat &slot: slots->sub_stats) {
+        TrackableItem *sub = slot.sub_stat;
 
-            cat_changed = true;
-            changed = true;
+        // Hermes value is always the cumulative total for one player.
+        // In singleplayer: overwrite directly (only one player).
+        // In coop HIGHEST mode: only apply if higher (preserves max across players).
+        if (new_value <= sub->progress) continue;
+        sub->progress = new_value;
+        if (player_uuid && player_uuid[0] != '\0') {
+            strncpy(sub->highest_contributor_uuid, player_uuid,
+                    sizeof(sub->highest_contributor_uuid) - 1);
+            sub->highest_contributor_uuid[sizeof(sub->highest_contributor_uuid) - 1] = '\0';
         }
 
-        if (cat_changed) {
-            int completed = 0;
-            for (int j = 0; j < stat_cat->criteria_count; j++) {
-                if (stat_cat->criteria[j] && stat_cat->criteria[j]->done)
-                    completed++;
-            }
-            stat_cat->completed_criteria_count = completed;
+        if (!sub->is_manually_completed) {
+            if (sub->goal > 0) sub->done = (sub->progress >= sub->goal);
+            else if (sub->goal == -1) sub->done = false; // infinite counter
+        }
 
-            if (!stat_cat->is_manually_completed) {
-                stat_cat->done = (stat_cat->criteria_count > 0 &&
-                                  completed >= stat_cat->criteria_count);
-            }
+        // Sub-stats of one category are adjacent, so each changed category is recounted once
+        if (slot.category != changed_cat) {
+            if (changed_cat) hermes_refresh_stat_category(changed_cat);
+            changed_cat = slot.category;
         }
+        changed = true;
     }
+    if (changed_cat) hermes_refresh_stat_category(changed_cat);
 
     // --- Active SUBGOAL_STAT stage in multi-stage goals ---
     // In coop HOST mode, multi-stage stages are handled by the cumulative function
     // (always summed across players, independent of the stat merge setting).
     if (!skip_multi_stage) {
-        for (int i = 0; i < t->template_data->multi_stage_goal_count; i++) {
-            MultiStageGoal *goal = t->template_data->multi_stage_goals[i];
-            if (!goal) continue;
-            if (goal->current_stage >= goal->stage_count) continue;
-
-            SubGoal *stage = goal->stages[goal->current_stage];
-            if (!stage || stage->type != SUBGOAL_STAT) continue;
-
-            bool matches = false;
-            if (is_modern) {
-                // Modern template format: "minecraft:picked_up/minecraft:wither_skeleton_skull"
-                const char *slash = strchr(stage->root_name, '/');
-                if (!slash) continue;
-
-                char s_cat[192], s_item[192];
-                size_t cat_len = (size_t) (slash - stage->root_name);
-                if (cat_len == 0 || cat_len >= sizeof(s_cat)) continue;
-
-                strncpy(s_cat, stage->root_name, cat_len);
-                s_cat[cat_len] = '\0';
-                strncpy(s_item, slash + 1, sizeof(s_item) - 1);
-                s_item[sizeof(s_item) - 1] = '\0';
-
-                matches = (strcmp(s_cat, h_cat) == 0 &&
-                           strcmp(s_item, h_item) == 0);
-            } else {
-                // Legacy/mid-era: direct compare, e.g. "5242881" or "stat.pickup.minecraft.skull"
-                matches = (strcmp(stage->root_name, hermes_key) == 0);
-            }
-
-            if (!matches) continue;
-
+        MultiStageGoal *handled_goal = nullptr;
+        for (const HermesStatSlots::Stage &slot: slots->stages) {
+            MultiStageGoal *goal = slot.goal;
+            // Only the stage current when the event arrives counts, a stage it completes doesn't get it too
+            if (goal == handled_goal || goal->current_stage != slot.stage_index) continue;
+            handled_goal = goal;
+
+            SubGoal *stage = goal->stages[slot.stage_index];
             if (new_value > stage->current_stat_progress) {
                 stage->current_stat_progress = new_value;
                 changed = true;
@@ -13509,92 +14369,42 @@ static bool hermes_apply_stat_event_cumulative(Tracker *t, const cJSON *data,
 
     if (delta == 0) return false;
 
-    char h_cat[192], h_item[192];
-    bool is_modern = hermes_parse_stat_key(hermes_key, h_cat, h_item, sizeof(h_cat));
+    const HermesStatSlots *slots = hermes_find_stat_slots(t->template_data, hermes_key);
+    if (!slots) return false;
 
     bool changed = false;
 
     // Regular stat categories (skip when only processing multi-stage stages)
     if (!multi_stage_only) {
-        for (int i = 0; i < t->template_data->stat_count; i++) {
-            TrackableCategory *stat_cat = t->template_data->stats[i];
-            if (!stat_cat) continue;
-
-            bool cat_changed = false;
+        TrackableCategory *changed_cat = nullptr;
+        for (const HermesStatSlots::SubStat &slot: slots->sub_stats) {
+            TrackableItem *sub = slot.sub_stat;
 
-            for (int j = 0; j < stat_cat->criteria_count; j++) {
-                TrackableItem *sub = stat_cat->criteria[j];
-                if (!sub) continue;
-
-                bool matches = false;
-                if (is_modern) {
-                    if (sub->stat_category_key[0] == '\0') continue;
-                    matches = (strcmp(sub->stat_category_key, h_cat) == 0 &&
-                               strcmp(sub->stat_item_key, h_item) == 0);
-                } else {
-                    matches = (strcmp(sub->root_name, hermes_key) == 0);
-                }
-
-                if (!matches) continue;
+            // Add the delta to the merged cumulative total
+            sub->progress += delta;
 
-                // Add the delta to the merged cumulative total
-                sub->progress += delta;
-
-                if (!sub->is_manually_completed) {
-                    if (sub->goal > 0) sub->done = (sub->progress >= sub->goal);
-                    else if (sub->goal == -1) sub->done = false;
-                }
-
-                cat_changed = true;
-                changed = true;
+            if (!sub->is_manually_completed) {
+                if (sub->goal > 0) sub->done = (sub->progress >= sub->goal);
+                else if (sub->goal == -1) sub->done = false;
             }
 
-            if (cat_changed) {
-                int completed = 0;
-                for (int j = 0; j < stat_cat->criteria_count; j++) {
-                    if (stat_cat->criteria[j] && stat_cat->criteria[j]->done)
-                        completed++;
-                }
-                stat_cat->completed_criteria_count = completed;
-
-                if (!stat_cat->is_manually_completed) {
-                    stat_cat->done = (stat_cat->criteria_count > 0 &&
-                                      completed >= stat_cat->criteria_count);
-                }
+            if (slot.category != changed_cat) {
+                if (changed_cat) hermes_refresh_stat_category(changed_cat);
+                changed_cat = slot.category;
             }
+            changed = true;
         }
+        if (changed_cat) hermes_refresh_stat_category(changed_cat);
     } // end if (!multi_stage_only)
 
     // Multi-stage goals with CUMULATIVE: also use delta
-    for (int i = 0; i < t->template_data->multi_stage_goal_count; i++) {
-        MultiStageGoal *goal = t->template_data->multi_stage_goals[i];
-        if (!goal) continue;
-        if (goal->current_stage >= goal->stage_count) continue;
-
-        SubGoal *stage = goal->stages[goal->current_stage];
-        if (!stage || stage->type != SUBGOAL_STAT) continue;
-
-        bool matches = false;
-        if (is_modern) {
-            const char *slash = strchr(stage->root_name, '/');
-            if (!slash) continue;
-
-            char s_cat[192], s_item[192];
-            size_t cat_len = (size_t) (slash - stage->root_name);
-            if (cat_len == 0 || cat_len >= sizeof(s_cat)) continue;
-
-            strncpy(s_cat, stage->root_name, cat_len);
-            s_cat[cat_len] = '\0';
-            strncpy(s_item, slash + 1, sizeof(s_item) - 1);
-            s_item[sizeof(s_item) - 1] = '\0';
-
-            matches = (strcmp(s_cat, h_cat) == 0 && strcmp(s_item, h_item) == 0);
-        } else {
-            matches = (strcmp(stage->root_name, hermes_key) == 0);
-        }
-
-        if (!matches) continue;
+    MultiStageGoal *handled_goal = nullptr;
+    for (const HermesStatSlots::Stage &slot: slots->stages) {
+        MultiStageGoal *goal = slot.goal;
+        if (goal == handled_goal || goal->current_stage != slot.stage_index) continue;
+        handled_goal = goal;
 
+        SubGoal *stage = goal->stages[slot.stage_index];
         stage->current_stat_progress += delta;
         changed = true;
 
@@ -13764,16 +14574,8 @@ static bool hermes_apply_advancement_event(Tracker *t, const cJSON *data,
 
 void tracker_recalculate_progress(Tracker *t, const AppSettings *settings) {
     if (!t || !t->template_data) return;
-    MC_Version version = settings_get_version_from_string(settings->version_str); {
-        bool changed;
-        int guard = 0;
-        do {
-            changed = tracker_update_custom_goal_linked_goals(t);
-            changed |= tracker_update_stat_linked_goals(t);
-            changed |= tracker_update_counter_goals(t);
-            changed |= tracker_update_multi_stage_linked_goals(t);
-        } while (changed && ++guard < 32);
-    }
+    MC_Version version = settings_get_version_from_string(settings->version_str);
+    tracker_propagate_linked_goals(t);
     bool was_completed = t->template_data->run_completed;
     tracker_calculate_overall_progress(t, version, settings);
 
@@ -13792,7 +14594,7 @@ void tracker_recalculate_progress(Tracker *t, const AppSettings *settings) {
 
 // Defined in main.cpp. Shared so the host-side Hermes path can update the
 // per-player and merged snapshot caches directly without re-reading disk.
-extern size_t serialize_template_data(TemplateData *td, char *buffer);
+extern size_t serialize_template_data(TemplateData *td, char *buffer, size_t capacity);
 
 extern bool merge_coop_progress(const char *buffer, TemplateData *target);
 
@@ -13832,7 +14634,7 @@ static bool hermes_apply_event_to_coop_snapshots(
     }
 
     // 1. Per-player snapshot: single-player semantics (highest-wins for stats).
-    if (src_snap && *src_snap && *src_snap_size >= sizeof(TemplateData)) {
+    if (src_snap && ipc_progress_state_valid(*src_snap, *src_snap_size)) {
         if (merge_coop_progress(*src_snap, t->template_data)) {
             bool changed = false;
             if (is_stat) {
@@ -13842,7 +14644,7 @@ static bool hermes_apply_event_to_coop_snapshots(
             }
             if (changed) {
                 tracker_recalculate_progress(t, settings);
-                size_t new_size = serialize_template_data(t->template_data, workbuf);
+                size_t new_size = serialize_template_data(t->template_data, workbuf, workbuf_size);
                 if (new_size > 0 && new_size <= workbuf_size) {
                     char *new_buf = (char *) realloc(*src_snap, new_size);
                     if (new_buf) {
@@ -13859,7 +14661,7 @@ static bool hermes_apply_event_to_coop_snapshots(
     // 2. Merged snapshot: coop_stat_merge-aware. Relies on the per-UUID delta
     //    cache (seeded from disk during tracker_update_coop_merged) so repeat
     //    events from the same player advance the merged total correctly.
-    if (t->coop_merged_snapshot && t->coop_merged_snapshot_size >= sizeof(TemplateData)) {
+    if (ipc_progress_state_valid(t->coop_merged_snapshot, t->coop_merged_snapshot_size)) {
         if (merge_coop_progress(t->coop_merged_snapshot, t->template_data)) {
             bool changed = false;
             const char *ev_uuid = source_uuid;
@@ -13921,7 +14723,7 @@ static bool hermes_apply_event_to_coop_snapshots(
                             size_t snap_sz = is_ghost
                                                  ? t->coop_ghost_snapshot_sizes[local]
                                                  : t->coop_player_snapshot_sizes[local];
-                            if (!snap || snap_sz < sizeof(TemplateData)) continue;
+                            if (!ipc_progress_state_valid(snap, snap_sz)) continue;
 
                             // Resolve this snapshot's player UUID up front so an assigned
                             // advancement can skip every player except its owner.
@@ -13997,7 +14799,7 @@ static bool hermes_apply_event_to_coop_snapshots(
             }
             if (changed) {
                 tracker_recalculate_progress(t, settings);
-                size_t new_size = serialize_template_data(t->template_data, workbuf);
+                size_t new_size = serialize_template_data(t->template_data, workbuf, workbuf_size);
                 if (new_size > 0 && new_size <= workbuf_size) {
                     char *new_buf = (char *) realloc(t->coop_merged_snapshot, new_size);
                     if (new_buf) {
@@ -14045,14 +14847,15 @@ static bool hermes_apply_event_to_coop_snapshots(
 // receiver broadcast. Returns true if any state changed.
 static bool hermes_process_decrypted_line(
     Tracker *t, const AppSettings *settings,
-    const std::string &decrypted,
+    const char *decrypted, size_t decrypted_len,
     char **workbuf_ptr, size_t workbuf_size,
     bool *snapshots_changed,
-    bool disk_authoritative = false) {
-    cJSON *event = cJSON_ParseWithLength(decrypted.c_str(), decrypted.size());
+    bool disk_authoritative = false,
+    long long *event_time_ms = nullptr) {
+    cJSON *event = cJSON_ParseWithLength(decrypted, decrypted_len);
     if (!event) {
         log_message(LOG_ERROR, "[TRACKER - HERMES] Failed to parse decrypted line (len=%zu)\n",
-                    decrypted.size());
+                    decrypted_len);
         return false;
     }
 
@@ -14066,6 +14869,13 @@ static bool hermes_process_decrypted_line(
 
     const char *type = type_json->valuestring;
 
+    // Report the time of every stat/advancement event, whoever it belongs to, so the replay
+    // index sees the same times the replay window itself filters on.
+    if (event_time_ms && (strcmp(type, "stat") == 0 || strcmp(type, "advancement") == 0)) {
+        cJSON *time_json = cJSON_GetObjectItem(event, "time");
+        if (cJSON_IsNumber(time_json)) *event_time_ms = (long long) time_json->valuedouble;
+    }
+
     // --- Player identity filter ---
     // Hermes events include a "player" object with "name" and "uuid".
     // Coop host accepts events from any roster player and remembers which
@@ -14218,11 +15028,42 @@ static bool hermes_process_decrypted_line(
 }
 
 
+// Most bytes read from play.log.enc at once, and the free space made in hermes_read_buf for it.
+#define HERMES_READ_CHUNK (64 * 1024)
+// Bytes of log between two Tracker::hermes_time_index marks. A replay decodes at most this much
+// before its window.
+#define HERMES_TIME_INDEX_STRIDE (16 * 1024)
+
+// Splits buf[0, len) into its complete '\n'-terminated lines, decrypts each one in place and
+// hands it to on_line(const char *line, size_t line_len) without the line ending. Empty lines
+// are skipped. Returns the number of bytes consumed, i.e. up to and including the last '\n';
+// anything after it is a partial line Minecraft is still writing.
+template<typename Fn>
+static size_t hermes_split_lines(const HermesRotator &rotator, char *buf, size_t len, Fn &&on_line) {
+    size_t pos = 0;
+    while (pos < len) {
+        char *nl = (char *) memchr(buf + pos, '\n', len - pos);
+        if (!nl) break;
+        size_t next = (size_t) (nl - buf) + 1;
+        size_t line_len = next - 1 - pos;
+        while (line_len > 0 && buf[pos + line_len - 1] == '\r') line_len--;
+        if (line_len > 0) {
+            rotator.processLine((uint8_t *) buf + pos, (int) line_len);
+            on_line(buf + pos, line_len);
+        }
+        pos = next;
+    }
+    return pos;
+}
+
 void tracker_poll_hermes_log(Tracker *t, const AppSettings *settings) {
     if (!settings->using_hermes || !t->hermes_active || !t->hermes_play_log)
         return;
 
-    if (fseek(t->hermes_play_log, t->hermes_file_offset, SEEK_SET) != 0)
+    // The bytes up to hermes_file_offset + hermes_read_len are already in memory, only read what
+    // was appended since. The handle is unbuffered, so each chunk is a single read().
+    FILE *f = t->hermes_play_log;
+    if (fseek(f, t->hermes_file_offset + (long) t->hermes_read_len, SEEK_SET) != 0)
         return;
 
     bool any_changed = false;
@@ -14231,42 +15072,59 @@ void tracker_poll_hermes_log(Tracker *t, const AppSettings *settings) {
     // match the broadcast buffer used on the file-merge path.
     char *workbuf = nullptr;
     const size_t workbuf_size = 4 * 1024 * 1024;
+    auto *time_index = static_cast<std::vector<HermesTimeMark> *>(t->hermes_time_index);
 
+    // Read at most one chunk at a time and process its lines before the next, so catching up on a
+    // long existing log (attaching mid-session) never holds more than a chunk plus one partial line.
     while (true) {
-        long start_offset = ftell(t->hermes_play_log);
-        std::string line_buf;
-        char chunk[8192];
-        bool newline_found = false;
-
-        // Read chunks until we hit the end of the line or EOF
-        while (fgets(chunk, sizeof(chunk), t->hermes_play_log)) {
-            line_buf += chunk;
-            if (!line_buf.empty() && line_buf.back() == '\n') {
-                newline_found = true;
+        if (t->hermes_read_cap - t->hermes_read_len < HERMES_READ_CHUNK) {
+            size_t new_cap = t->hermes_read_cap ? t->hermes_read_cap * 2 : HERMES_READ_CHUNK * 2;
+            while (new_cap - t->hermes_read_len < HERMES_READ_CHUNK) new_cap *= 2;
+            char *grown = (char *) realloc(t->hermes_read_buf, new_cap);
+            if (!grown) {
+                log_message(LOG_ERROR, "[TRACKER - HERMES] Failed to grow read buffer to %zu bytes\n", new_cap);
                 break;
             }
+            t->hermes_read_buf = grown;
+            t->hermes_read_cap = new_cap;
         }
+        size_t got = fread(t->hermes_read_buf + t->hermes_read_len, 1, HERMES_READ_CHUNK, f);
+        t->hermes_read_len += got;
 
-        if (!newline_found) {
-            // Incomplete line - Minecraft is still writing or we reached EOF. Retry next frame.
-            // Reset to start of this line so we read it completely next time.
-            fseek(t->hermes_play_log, start_offset, SEEK_SET);
-            break;
-        }
+        size_t consumed = hermes_split_lines(
+            t->hermes_rotator, t->hermes_read_buf, t->hermes_read_len, [&](const char *line, size_t line_len) {
+                long line_offset = t->hermes_file_offset + (long) (line - t->hermes_read_buf);
+                if (time_index && (time_index->empty() ||
+                                   line_offset - time_index->back().offset >= HERMES_TIME_INDEX_STRIDE)) {
+                    time_index->push_back({line_offset, t->hermes_newest_event_ms});
+                }
 
-        // Commit read position past this complete line.
-        t->hermes_file_offset = ftell(t->hermes_play_log);
+                long long event_time_ms = 0;
+                if (hermes_process_decrypted_line(t, settings, line, line_len, &workbuf, workbuf_size,
+                                                  &snapshots_changed, false, &event_time_ms)) {
+                    any_changed = true;
+                }
+                if (event_time_ms > t->hermes_newest_event_ms) t->hermes_newest_event_ms = event_time_ms;
+            });
 
-        while (!line_buf.empty() && (line_buf.back() == '\n' || line_buf.back() == '\r')) {
-            line_buf.pop_back();
+        // Commit the read position past the complete lines and keep the partial tail, which the
+        // next read appends to.
+        t->hermes_file_offset += (long) consumed;
+        t->hermes_read_len -= consumed;
+        if (consumed > 0 && t->hermes_read_len > 0) {
+            memmove(t->hermes_read_buf, t->hermes_read_buf + consumed, t->hermes_read_len);
         }
-        if (line_buf.empty()) continue;
 
-        std::string decrypted = t->hermes_rotator.processLine(line_buf);
+        if (got < HERMES_READ_CHUNK) break; // Caught up with the writer (or a read error, retried next frame)
+    }
+    clearerr(f);
 
-        if (hermes_process_decrypted_line(t, settings, decrypted,
-                                          &workbuf, workbuf_size, &snapshots_changed)) {
-            any_changed = true;
+    // An unusually long line may have grown the buffer. Once it's processed, go back to the usual size.
+    if (t->hermes_read_cap > HERMES_READ_CHUNK * 2 && t->hermes_read_len <= HERMES_READ_CHUNK) {
+        char *shrunk = (char *) realloc(t->hermes_read_buf, HERMES_READ_CHUNK * 2);
+        if (shrunk) {
+            t->hermes_read_buf = shrunk;
+            t->hermes_read_cap = HERMES_READ_CHUNK * 2;
         }
     }
 
@@ -14296,7 +15154,9 @@ void tracker_poll_hermes_log(Tracker *t, const AppSettings *settings) {
 // We read [0, hermes_file_offset) - events past the offset are future events
 // that live polling will pick up normally. The window is driven off the
 // newest event's time (not wall-clock) so paused / AFK sessions still pick
-// the right cutoff. HermesRotator is stateless, so seeking is safe.
+// the right cutoff. HermesRotator is stateless, so seeking is safe. The newest
+// time and hermes_time_index are kept by the live poll, so only the log from the
+// last index mark before the cutoff onwards is read and decoded.
 //
 // Safety:
 //   - Stats (HIGHEST): hermes_apply_stat_event only accepts new_value > progress.
@@ -14314,87 +15174,71 @@ void tracker_hermes_replay_window(Tracker *t, const AppSettings *settings,
     if (!settings->using_hermes || !t->hermes_active || !t->hermes_play_log) return;
     if (t->hermes_file_offset <= 0) return;
 
-    long saved_offset = t->hermes_file_offset;
-    if (fseek(t->hermes_play_log, 0, SEEK_SET) != 0) return;
-
-    struct ReplayEntry {
-        std::string line;
-        long long time_ms;
-    };
-    std::vector<ReplayEntry> entries;
-    long long max_time = 0;
+    long long max_time = t->hermes_newest_event_ms;
+    if (max_time == 0) return;
+    long long cutoff = max_time - window_ms;
 
-    while (true) {
-        long pos = ftell(t->hermes_play_log);
-        if (pos < 0 || pos >= saved_offset) break;
-
-        std::string line_buf;
-        char chunk[8192];
-        bool newline_found = false;
-        while (fgets(chunk, sizeof(chunk), t->hermes_play_log)) {
-            line_buf += chunk;
-            if (!line_buf.empty() && line_buf.back() == '\n') {
-                newline_found = true;
-                break;
-            }
-            if (ftell(t->hermes_play_log) >= saved_offset) break;
-        }
-        if (!newline_found && line_buf.empty()) break;
+    // Every line before a mark whose time_before is older than the cutoff is outside the window.
+    // time_before never decreases, so the last such mark is found by binary search.
+    long start_offset = 0;
+    auto *time_index = static_cast<std::vector<HermesTimeMark> *>(t->hermes_time_index);
+    if (time_index && !time_index->empty()) {
+        auto it = std::lower_bound(time_index->begin(), time_index->end(), cutoff,
+                                   [](const HermesTimeMark &m, long long c) { return m.time_before < c; });
+        if (it != time_index->begin()) start_offset = std::prev(it)->offset;
+    }
+
+    // Read the tail in one go and decrypt it in place. The live poll seeks on its own, so the
+    // handle position doesn't need restoring.
+    size_t region_len = (size_t) (t->hermes_file_offset - start_offset);
+    char *region = (char *) malloc(region_len);
+    if (!region) return;
+    if (fseek(t->hermes_play_log, start_offset, SEEK_SET) != 0) {
+        free(region);
+        return;
+    }
+    region_len = fread(region, 1, region_len, t->hermes_play_log);
+    clearerr(t->hermes_play_log);
 
-        while (!line_buf.empty() && (line_buf.back() == '\n' || line_buf.back() == '\r'))
-            line_buf.pop_back();
-        if (line_buf.empty()) continue;
+    char *workbuf = nullptr;
+    const size_t workbuf_size = 4 * 1024 * 1024;
+    bool any_changed = false;
+    bool snapshots_changed = false;
+    size_t scanned = 0;
+    size_t applied = 0;
 
-        std::string decrypted = t->hermes_rotator.processLine(line_buf);
-        cJSON *peek = cJSON_ParseWithLength(decrypted.c_str(), decrypted.size());
-        if (!peek) continue;
+    hermes_split_lines(t->hermes_rotator, region, region_len, [&](const char *line, size_t line_len) {
+        cJSON *peek = cJSON_ParseWithLength(line, line_len);
+        if (!peek) return;
 
         cJSON *type_json = cJSON_GetObjectItem(peek, "type");
         cJSON *time_json = cJSON_GetObjectItem(peek, "time");
         bool keep = cJSON_IsString(type_json) && cJSON_IsNumber(time_json) &&
                     (strcmp(type_json->valuestring, "stat") == 0 ||
                      strcmp(type_json->valuestring, "advancement") == 0);
-        if (keep) {
-            long long tm = (long long) time_json->valuedouble;
-            if (tm > max_time) max_time = tm;
-            ReplayEntry e;
-            e.line = std::move(decrypted);
-            e.time_ms = tm;
-            entries.push_back(std::move(e));
-        }
+        long long tm = keep ? (long long) time_json->valuedouble : 0;
         cJSON_Delete(peek);
-    }
-
-    // Forward-polling must resume exactly where it left off.
-    fseek(t->hermes_play_log, saved_offset, SEEK_SET);
-
-    if (entries.empty() || max_time == 0) return;
-    long long cutoff = max_time - window_ms;
+        if (!keep) return;
 
-    char *workbuf = nullptr;
-    const size_t workbuf_size = 4 * 1024 * 1024;
-    bool any_changed = false;
-    bool snapshots_changed = false;
-    size_t applied = 0;
-
-    for (auto &e: entries) {
-        if (e.time_ms < cutoff) continue;
+        scanned++;
+        if (tm < cutoff) return;
         // disk_authoritative = true: this replay runs right after a full disk rebuild, so the
         // game files win. Advancements the disk records are not re-completed by replayed events.
-        if (hermes_process_decrypted_line(t, settings, e.line,
+        if (hermes_process_decrypted_line(t, settings, line, line_len,
                                           &workbuf, workbuf_size, &snapshots_changed,
                                           /*disk_authoritative=*/true)) {
             any_changed = true;
         }
         applied++;
-    }
+    });
 
     if (workbuf) free(workbuf);
+    free(region);
 
     log_message(LOG_INFO,
-                "[TRACKER - HERMES] Replay window: scanned %zu event(s), applied %zu within %lldms "
-                "(cutoff=%lld, newest=%lld).\n",
-                entries.size(), applied, window_ms, cutoff, max_time);
+                "[TRACKER - HERMES] Replay window: scanned %zu event(s) from offset %ld, applied %zu "
+                "within %lldms (cutoff=%lld, newest=%lld).\n",
+                scanned, start_offset, applied, window_ms, cutoff, max_time);
 
     if (any_changed) {
         if (!snapshots_changed) {
@@ -14498,6 +15342,9 @@ static void tracker_apply_layout_overlay(TemplateData *td, cJSON *layout_json) {
 }
 
 bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
+    // Goals may have been added, removed or reordered, so the overlay needs the whole template again.
+    t->ipc_full_publish_pending = true;
+
     // The template editor's unsaved copy wins over the files while the Visual Layout Editor is open.
     // Duplicated rather than consumed, because the override has to survive every reload until the
     // editor drops it, while everything parsed here is deleted at the end of this function.
@@ -14606,7 +15453,8 @@ bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
                              ? (s_live_layout_json ? cJSON_Duplicate(s_live_layout_json, 1) : nullptr)
                              : cJSON_from_file(t->layout_path);
 
-    // Load settings.json to check for custom progress
+    // Load settings.json to check for custom progress, with the journaled changes folded in
+    settings_progress_journal_fold();
     cJSON *settings_json = cJSON_from_file(get_settings_file_path());
     if (!settings_json) {
         log_message(LOG_ERROR, "[TRACKER] Failed to load or parse settings file.\n");
@@ -14629,6 +15477,9 @@ bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
 
     MC_Version version = settings_get_version_from_string(settings->version_str);
 
+    // Everything parsed below is allocated from the template arena, kept across reloads
+    if (!t->template_data->arena) t->template_data->arena = template_arena_new();
+
     // Parse the main categories
     // False as it's for advancements
     tracker_parse_categories(t, advancements_json, lang_json, &t->template_data->advancements,
@@ -14668,7 +15519,7 @@ bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
                                 &t->template_data->counter_goals,
                                 &t->template_data->counter_goal_count, settings);
 
-    tracker_parse_decorations(decorations_json, lang_json,
+    tracker_parse_decorations(t->template_data->arena, decorations_json, lang_json,
                               &t->template_data->decorations,
                               &t->template_data->decoration_count);
 
@@ -14682,6 +15533,19 @@ bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
     // Detect and flag criteria that are shared between multiple advancements
     tracker_detect_shared_icons(t, settings);
 
+    // Intern goal names, then point every linked goal straight at its target and compile them into the
+    // dependency graph
+    tracker_intern_template_names(t->template_data);
+    tracker_resolve_linked_goals(t->template_data);
+    tracker_build_linked_goal_graph(t->template_data);
+    // Hash advancement and criterion names for matching the player advancements file in one pass
+    tracker_build_advancement_match_index(t->template_data);
+    // Collect the player file keys the template reads, so the player files are streamed against them
+    tracker_build_player_file_keys(t->template_data);
+    // Map Hermes stat keys to the goals they feed, so a live stat event only touches those
+    tracker_build_hermes_stat_index(t->template_data);
+    json_file_cache_clear(t->json_file_cache);
+
     // Automatically synchronize settings.json with the newly loaded template
     cJSON *settings_root = cJSON_from_file(get_settings_file_path());
     if (!settings_root) settings_root = cJSON_CreateObject();
@@ -14910,7 +15774,9 @@ bool tracker_load_and_parse_data(Tracker *t, AppSettings *settings) {
         // own thread ~100ms later, long after the clear, which is what turned this into a reinit loop.
         SDL_SetAtomicInt(&g_suppress_settings_watch, 1);
         // Atomically write the synchronized settings back to the file.
-        if (!cJSON_write_to_file_atomic(get_settings_file_path(), settings_root)) {
+        if (cJSON_write_to_file_atomic(get_settings_file_path(), settings_root)) {
+            settings_progress_store_commit(settings_root);
+        } else {
             log_message(LOG_ERROR, "[TRACKER] Failed to write synchronized settings.json.\n");
         }
     } else {
@@ -14964,6 +15830,9 @@ void tracker_free(Tracker **tracker, AppSettings *settings) {
             settings_save(settings, t->template_data, SAVE_CONTEXT_ALL);
         }
 
+        free(t->ipc_goal_states);
+        t->ipc_goal_states = nullptr;
+
         // Free all textures in the cache
         if (t->texture_cache) {
             for (int i = 0; i < t->texture_cache_count; i++) {
@@ -14994,6 +15863,7 @@ void tracker_free(Tracker **tracker, AppSettings *settings) {
         if (t->template_data) {
             tracker_free_template_data(t->template_data);
             // This ONLY frees the CONTENT of the struct, not the struct itself
+            template_arena_free(t->template_data->arena);
             free(t->template_data); // This frees the struct, STRUCT FREED HERE
             t->template_data = nullptr;
         }
@@ -15011,10 +15881,12 @@ void tracker_free(Tracker **tracker, AppSettings *settings) {
         }
 
         // Close Hermes log if open
-        if (t->hermes_play_log) {
-            fclose(t->hermes_play_log);
-            t->hermes_play_log = nullptr;
-        }
+        hermes_close_play_log(t);
+        free(t->hermes_read_buf);
+        t->hermes_read_buf = nullptr;
+        t->hermes_read_cap = 0;
+        delete static_cast<std::vector<HermesTimeMark> *>(t->hermes_time_index);
+        t->hermes_time_index = nullptr;
         t->hermes_active = false;
         t->hermes_world_name[0] = '\0';
 
@@ -15030,6 +15902,9 @@ void tracker_free(Tracker **tracker, AppSettings *settings) {
             t->hermes_adv_mtime_by_uuid = nullptr;
         }
 
+        json_file_cache_free(t->json_file_cache);
+        t->json_file_cache = nullptr;
+
         if (t->legacy_player_snapshots) {
             delete static_cast<std::unordered_map<std::string, PlayerLegacySnapshot> *>(t->legacy_player_snapshots);
             t->legacy_player_snapshots = nullptr;
@@ -15199,7 +16074,7 @@ void tracker_save_notes(const Tracker *t, const AppSettings *settings) {
 void tracker_print_debug_status(Tracker *t, const AppSettings *settings) {
     if (!t || !t->template_data) return;
 
-    cJSON *settings_json = cJSON_from_file(get_settings_file_path());
+    cJSON *settings_json = settings_progress_store_get();
     cJSON *override_obj = get_per_uuid_progress_obj(settings_json, "stat_progress_override",
                                                     settings->local_player.uuid);
 
@@ -66,6 +66,12 @@ struct Tracker {
     sem_t *mutex;
 #endif
     SharedData *p_shared_data; // Pointer to the mapped shared memory
+    IPCTemplateSegment ipc_template_segment; // Template images, re-created larger when a template outgrows it
+    int ipc_template_generation; // Generation of the last template segment created
+    IPCWakeup ipc_wakeup; // Signaled after every publish so a sleeping overlay picks it up at once
+    IPCGoalState *ipc_goal_states; // Goal states of the last overlay publish, diffed to publish only deltas
+    int ipc_goal_state_count;
+    bool ipc_full_publish_pending; // Template reloaded or world changed: the next publish ships the full template
 
     // --- Texture Cache ---
     TextureCacheEntry *texture_cache; // Array of texture cache entries
@@ -225,6 +231,12 @@ struct Tracker {
     HermesRotator hermes_rotator; // cipher tables, built once
     FILE *hermes_play_log; // file handle for the restricted play.log.enc
     long hermes_file_offset; // how far we've already read
+    char *hermes_read_buf; // Bytes read past hermes_file_offset that don't form a complete line yet
+    size_t hermes_read_len; // Pending bytes at the start of hermes_read_buf
+    size_t hermes_read_cap; // Allocated size of hermes_read_buf: two read chunks, more while a longer line is pending
+    void *hermes_time_index; // Sparse (line offset, newest event time before it) marks over [0, hermes_file_offset)
+    // (std::vector<HermesTimeMark>*, managed in tracker.cpp)
+    long long hermes_newest_event_ms; // Newest stat/advancement "time" read from the log so far
     bool hermes_active; // true if Hermes was detected for this world
     char hermes_world_name[MAX_PATH_LENGTH]; // world the play.log.enc handle was opened for
     bool hermes_wants_ipc_flush; // set when in-memory state changed; cleared by main loop after IPC write
@@ -238,6 +250,10 @@ struct Tracker {
     uint64_t hermes_adv_file_mtime_ms; // Singleplayer / direct view: local player's adv file mtime
     void *hermes_adv_mtime_by_uuid; // Coop: per-player adv file mtime keyed by lowercase UUID
     // (std::unordered_map<std::string, uint64_t>*, managed in tracker.cpp)
+
+    // Parsed player files and settings.json keyed by path, reused while their size/mtime/hash fingerprint
+    // is unchanged (file_utils.h). Cleared on template load, as the streamed files depend on its keys.
+    struct JsonFileCache *json_file_cache;
 };
 
 /**
@@ -0,0 +1,186 @@
+// Copyright (c) 2026 LNXSeus. All Rights Reserved.
+//
+// This project is proprietary software. You are granted a license to use the software as-is.
+// You may not copy, distribute, modify, reverse-engineer, maintain a fork, or use this software
+// or its source code in any way without the express written permission of the copyright holder.
+//
+// Created by Linus on 16.10.2026.
+//
+
+// Micro-benchmark for matching a player advancements file against the template (tracker.cpp).
+// Generates a synthetic modded advancements file with 1,500 advancements, then times
+//   - the old matching: cJSON_GetObjectItem per template advancement and cJSON_HasObjectItem per
+//     template criterion, each a linear case-insensitive scan, and
+//   - the single pass: one walk over the file and over each entry's criteria, looked up in names hashed
+//     once per template load (AdvancementMatchIndex, advancement_match_entries/_criteria).
+// Both run over a template tracking every advancement and over one tracking a tenth of them, and must
+// mark the same criteria. The single pass below mirrors tracker.cpp, keep the two in sync.
+//
+// Opt-in: cmake -DADVANCELY_BUILD_TESTS=ON, then run advancement_match_bench (not part of ctest).
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cJSON.h"
+
+static const int ADVANCEMENT_COUNT = 1500;
+
+struct BenchAdvancement {
+    std::string root_name;
+    std::vector<std::string> criteria;
+};
+
+// Lowercased hash keys, as in tracker.cpp's append_lower_ascii()
+static void append_lower_ascii(std::string &key, const char *s) {
+    for (; *s; s++) key += (char) tolower((unsigned char) *s);
+}
+
+struct BenchMatchIndex {
+    std::unordered_multimap<std::string, int> advancements;
+    std::vector<std::unordered_multimap<std::string, int> > criteria;
+    std::string probe;
+};
+
+static void build_index(const std::vector<BenchAdvancement> &tpl, BenchMatchIndex &index) {
+    index.criteria.resize(tpl.size());
+    std::string key;
+    for (size_t i = 0; i < tpl.size(); i++) {
+        key.clear();
+        append_lower_ascii(key, tpl[i].root_name.c_str());
+        index.advancements.emplace(key, (int) i);
+        for (size_t j = 0; j < tpl[i].criteria.size(); j++) {
+            key.clear();
+            append_lower_ascii(key, tpl[i].criteria[j].c_str());
+            index.criteria[i].emplace(key, (int) j);
+        }
+    }
+}
+
+// Old path: one linear lookup per template advancement and per template criterion.
+static long match_per_lookup(const std::vector<BenchAdvancement> &tpl, const cJSON *file) {
+    long done = 0;
+    for (const BenchAdvancement &adv: tpl) {
+        cJSON *entry = cJSON_GetObjectItem(file, adv.root_name.c_str());
+        if (!entry) continue;
+        cJSON *criteria = cJSON_GetObjectItem(entry, "criteria");
+        if (!criteria) continue;
+        for (const std::string &crit: adv.criteria) {
+            if (cJSON_HasObjectItem(criteria, crit.c_str())) done++;
+        }
+    }
+    return done;
+}
+
+// New path: one walk over the file and over each matched entry's criteria.
+static long match_single_pass(const std::vector<BenchAdvancement> &tpl, BenchMatchIndex &index,
+                              const cJSON *file, std::vector<const cJSON *> &entries, std::vector<char> &flags) {
+    entries.assign(tpl.size(), nullptr);
+    for (const cJSON *entry = file->child; entry; entry = entry->next) {
+        if (!entry->string) continue;
+        index.probe.clear();
+        append_lower_ascii(index.probe, entry->string);
+        auto range = index.advancements.equal_range(index.probe);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!entries[it->second]) entries[it->second] = entry;
+        }
+    }
+    long done = 0;
+    for (size_t i = 0; i < tpl.size(); i++) {
+        if (!entries[i]) continue;
+        cJSON *criteria = cJSON_GetObjectItem(entries[i], "criteria");
+        if (!criteria) continue;
+        flags.assign(tpl[i].criteria.size(), 0);
+        for (const cJSON *entry = criteria->child; entry; entry = entry->next) {
+            if (!entry->string) continue;
+            index.probe.clear();
+            append_lower_ascii(index.probe, entry->string);
+            auto range = index.criteria[i].equal_range(index.probe);
+            for (auto it = range.first; it != range.second; ++it) flags[it->second] = 1;
+        }
+        for (char f: flags) done += f;
+    }
+    return done;
+}
+
+// A modded advancements file: ADVANCEMENT_COUNT entries with 1-30 criteria each, most of them earned.
+static cJSON *generate_player_file(std::mt19937 &rng, std::vector<BenchAdvancement> &all) {
+    cJSON *root = cJSON_CreateObject();
+    char name[128];
+    for (int i = 0; i < ADVANCEMENT_COUNT; i++) {
+        BenchAdvancement adv;
+        snprintf(name, sizeof(name), "modpack_%d:quests/chapter_%d/advancement_%d", i % 12, i / 50, i);
+        adv.root_name = name;
+        cJSON *entry = cJSON_CreateObject();
+        cJSON *criteria = cJSON_CreateObject();
+        int criteria_count = 1 + (int) (rng() % 30);
+        int earned = 0;
+        for (int j = 0; j < criteria_count; j++) {
+            snprintf(name, sizeof(name), "modpack_%d:item/criterion_%d_%d", i % 12, i, j);
+            adv.criteria.push_back(name);
+            if (rng() % 4 != 0) {
+                cJSON_AddStringToObject(criteria, name, "2026-10-16 12:00:00 +0200");
+                earned++;
+            }
+        }
+        cJSON_AddItemToObject(entry, "criteria", criteria);
+        cJSON_AddBoolToObject(entry, "done", earned == criteria_count);
+        cJSON_AddItemToObject(root, adv.root_name.c_str(), entry);
+        all.push_back(adv);
+    }
+    cJSON_AddNumberToObject(root, "DataVersion", 3955);
+    return root;
+}
+
+// Average microseconds per call of fn over enough iterations to run for about half a second.
+template<typename Fn>
+static double time_us(Fn &&fn, long *result) {
+    using clock = std::chrono::steady_clock;
+    long iterations = 0;
+    auto start = clock::now();
+    double elapsed = 0.0;
+    do {
+        *result = fn();
+        iterations++;
+        elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+    } while (elapsed < 500000.0);
+    return elapsed / (double) iterations;
+}
+
+static bool run_case(const char *label, const std::vector<BenchAdvancement> &tpl, const cJSON *file) {
+    BenchMatchIndex index;
+    build_index(tpl, index);
+    std::vector<const cJSON *> entries;
+    std::vector<char> flags;
+
+    long old_done = 0, new_done = 0;
+    double old_us = time_us([&] { return match_per_lookup(tpl, file); }, &old_done);
+    double new_us = time_us([&] { return match_single_pass(tpl, index, file, entries, flags); }, &new_done);
+    printf("%-28s per-lookup %10.1f us   single pass %8.1f us   speedup %6.1fx   (%ld criteria met)\n",
+           label, old_us, new_us, old_us / new_us, new_done);
+    if (old_done != new_done) {
+        printf("FAIL: per-lookup matched %ld criteria, single pass %ld\n", old_done, new_done);
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    std::mt19937 rng(20261016u);
+    std::vector<BenchAdvancement> all;
+    cJSON *file = generate_player_file(rng, all);
+
+    // A template tracking every tenth advancement of the pack
+    std::vector<BenchAdvancement> tenth;
+    for (size_t i = 0; i < all.size(); i += 10) tenth.push_back(all[i]);
+
+    bool ok = run_case("1500 of 1500 tracked", all, file);
+    ok = run_case("150 of 1500 tracked", tenth, file) && ok;
+    cJSON_Delete(file);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
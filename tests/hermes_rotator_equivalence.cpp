@@ -0,0 +1,107 @@
+// Copyright (c) 2026 LNXSeus. All Rights Reserved.
+//
+// This project is proprietary software. You are granted a license to use the software as-is.
+// You may not copy, distribute, modify, reverse-engineer, maintain a fork, or use this software
+// or its source code in any way without the express written permission of the copyright holder.
+//
+// Created by Linus on 16.10.2026.
+//
+
+// Randomized equivalence test for the vectorised HermesRotator kernels. Every kernel the host supports
+// (scalar, SSSE3 and AVX2 on x86, NEON on AArch64) must decode random lines byte for byte like
+// processLineScalar(). Lines are random bytes, including values outside the substituted [33,126] range,
+// at every length from 0 to 320 plus a few long ones, and start at random offsets so unaligned loads are
+// covered. Guard bytes around each line catch kernels writing past its ends.
+//
+// Opt-in: cmake -DADVANCELY_BUILD_TESTS=ON, then ctest. An optional argument replaces the fixed seed.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "hermes_rotator.h"
+
+static const int GUARD = 32; // Bytes checked on both sides of every line
+static const uint8_t GUARD_BYTE = 0xA5;
+
+// Decodes one random line with the rotator's current kernel and with the scalar reference.
+// Returns false (and prints the first difference) on a mismatch or a touched guard byte.
+static bool check_line(const HermesRotator &rotator, std::mt19937 &rng, int len) {
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    std::uniform_int_distribution<int> printable_dist(33, 126);
+    std::uniform_int_distribution<int> offset_dist(0, 31);
+    // Half the lines are mostly Hermes text, the rest any byte at all
+    bool mostly_printable = (rng() & 1) != 0;
+
+    int offset = offset_dist(rng);
+    std::vector<uint8_t> buffer((size_t) GUARD + offset + len + GUARD, GUARD_BYTE);
+    uint8_t *line = buffer.data() + GUARD + offset;
+    for (int i = 0; i < len; i++) {
+        bool printable = mostly_printable && (rng() % 16) != 0;
+        line[i] = (uint8_t) (printable ? printable_dist(rng) : byte_dist(rng));
+    }
+
+    std::vector<uint8_t> expected(line, line + len);
+    rotator.processLineScalar(expected.data(), len);
+    rotator.processLine(line, len);
+
+    for (int i = 0; i < len; i++) {
+        if (line[i] != expected[i]) {
+            printf("FAIL: simd level %d, length %d, offset %d: byte %d is 0x%02x, expected 0x%02x\n",
+                   rotator.simdLevel(), len, offset, i, line[i], expected[i]);
+            return false;
+        }
+    }
+    for (int i = 0; i < GUARD + offset; i++) {
+        if (buffer[i] != GUARD_BYTE) {
+            printf("FAIL: simd level %d, length %d, offset %d: wrote %d bytes before the line\n",
+                   rotator.simdLevel(), len, offset, GUARD + offset - i);
+            return false;
+        }
+    }
+    for (int i = 0; i < GUARD; i++) {
+        if (line[len + i] != GUARD_BYTE) {
+            printf("FAIL: simd level %d, length %d, offset %d: wrote past the line end\n",
+                   rotator.simdLevel(), len, offset);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    unsigned int seed = argc > 1 ? (unsigned int) strtoul(argv[1], nullptr, 10) : 20261016u;
+    std::mt19937 rng(seed);
+
+    HermesRotator rotator;
+    const int max_level = rotator.simdLevel();
+    printf("Seed %u, host supports simd level %d\n", seed, max_level);
+
+    const int long_lengths[] = {511, 512, 1000, 4096, 65537};
+    int failures = 0;
+    for (int level = 0; level <= max_level; level++) {
+        rotator.limitSimdLevel(level);
+        long checked = 0;
+        for (int len = 0; len <= 320 && failures < 10; len++) {
+            for (int trial = 0; trial < 200; trial++) {
+                checked++;
+                if (!check_line(rotator, rng, len) && ++failures >= 10) break;
+            }
+        }
+        for (int len: long_lengths) {
+            if (failures >= 10) break;
+            checked++;
+            if (!check_line(rotator, rng, len)) failures++;
+        }
+        printf("Simd level %d: %ld lines checked\n", rotator.simdLevel(), checked);
+    }
+
+    if (failures > 0) {
+        printf("%d mismatch(es)\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("All kernels match the scalar decode\n");
+    return EXIT_SUCCESS;
+}